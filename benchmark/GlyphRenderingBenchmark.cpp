@@ -30,7 +30,7 @@ void GlyphRenderingBenchmark::RunBenchmark() {
 
         // setup
         font_ = font_manager_->CreateFontByPixelSize(font_file_, 0, 60, font_type, 2);
-        font_manager_->PreloadGlyph(font_, char_set_);
+        font_manager_->PreloadGlyphs(font_, char_set_);
         
         CreateTextBuffers(font_type);
         SetTextToDisplay();
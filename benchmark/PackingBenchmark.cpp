@@ -0,0 +1,103 @@
+﻿#include "PackingBenchmark.h"
+
+#include <memory>
+#include <stb_truetype.h>
+#include <helper/MappedFile.h>
+#include <helper/Timer.h>
+#include <utilities.h>
+
+PackingBenchmark::PackingBenchmark(const std::vector<std::string> &font_paths) {
+    font_paths_ = font_paths;
+}
+
+void PackingBenchmark::SetupBenchmark(uint16_t texture_size, const std::vector<uint32_t> &pixel_sizes, uint16_t glyph_padding) {
+    texture_size_ = texture_size;
+    pixel_sizes_ = pixel_sizes;
+    glyph_padding_ = glyph_padding;
+
+    glyph_sizes_.clear();
+    for (const auto &font_path: font_paths_) {
+        CollectGlyphSizes(font_path);
+    }
+}
+
+std::vector<PackingResult> PackingBenchmark::RunBenchmark(const std::vector<RectanglePackerType::Enum> &packer_types) {
+    std::vector<PackingResult> results;
+    for (auto packer_type: packer_types) {
+        results.push_back(Replay(packer_type));
+    }
+    return results;
+}
+
+void PackingBenchmark::CollectGlyphSizes(const std::string &font_path) {
+    MappedFile file;
+    if (!file.Open(font_path.c_str())) {
+        PrintError(("Could not open font " + font_path).c_str());
+        return;
+    }
+
+    stbtt_fontinfo font;
+    if (!stbtt_InitFont(&font, file.GetData(), stbtt_GetFontOffsetForIndex(file.GetData(), 0))) {
+        PrintError(("Could not parse font " + font_path).c_str());
+        return;
+    }
+
+    for (auto pixel_size: pixel_sizes_) {
+        const float scale = stbtt_ScaleForPixelHeight(&font, (float) pixel_size);
+        // the basic multilingual plane, the atlas would receive the glyphs in a similar order
+        for (int code_point = 0x20; code_point < 0xFFFF; code_point++) {
+            const int glyph_index = stbtt_FindGlyphIndex(&font, code_point);
+            if (glyph_index == 0) {
+                continue;
+            }
+
+            int x0, y0, x1, y1;
+            stbtt_GetGlyphBitmapBox(&font, glyph_index, scale, scale, &x0, &y0, &x1, &y1);
+            if (x1 <= x0 || y1 <= y0) {
+                continue;
+            }
+
+            // same size as the region requested by the atlas, padding and the one pixel gap included
+            GlyphSize size{};
+            size.width = (uint16_t) (x1 - x0 + 2 * glyph_padding_ + 1);
+            size.height = (uint16_t) (y1 - y0 + 2 * glyph_padding_ + 1);
+            glyph_sizes_.push_back(size);
+        }
+    }
+}
+
+PackingResult PackingBenchmark::Replay(RectanglePackerType::Enum packer_type) const {
+    std::vector<std::unique_ptr<RectanglePacker>> faces;
+    auto add_face = [&] {
+        faces.emplace_back(RectanglePacker::Create(packer_type));
+        faces.back()->Init(texture_size_, texture_size_);
+    };
+    add_face();
+
+    double total_time = 0;
+    {
+        Timer timer("Packing", [&](double time) { total_time = time; });
+        for (const auto &size: glyph_sizes_) {
+            uint16_t x, y;
+            if (faces.back()->AddRectangle(size.width, size.height, x, y)) {
+                continue;
+            }
+
+            // like the atlas, a full face is never revisited
+            add_face();
+            if (!faces.back()->AddRectangle(size.width, size.height, x, y)) {
+                break;
+            }
+        }
+    }
+
+    PackingResult result{};
+    result.face_count = (uint32_t) faces.size();
+    const size_t full_faces = faces.size() > 1 ? faces.size() - 1 : 1;
+    for (size_t ii = 0; ii < full_faces; ii++) {
+        result.occupancy += faces[ii]->GetUsageRatio();
+    }
+    result.occupancy /= (double) full_faces;
+    result.insert_time_us = glyph_sizes_.empty() ? 0.0 : total_time * 1000.0 / (double) glyph_sizes_.size();
+    return result;
+}
@@ -0,0 +1,42 @@
+﻿#pragma once
+
+#include <font_processing/RectanglePacker.h>
+#include <string>
+#include <vector>
+
+struct PackingResult {
+    /// number of atlas faces needed for all the glyphs
+    uint32_t face_count;
+    /// mean usage ratio of the faces filled before a new one was needed (the last face if there is only one)
+    double occupancy;
+    /// mean time of an AddRectangle call in microseconds
+    double insert_time_us;
+};
+
+// PackingBenchmark replays the glyph sizes of real fonts, in code point order as the atlas sees
+// them, through the rectangle packers and reports how well and how fast they fill the faces.
+class PackingBenchmark {
+public:
+    explicit PackingBenchmark(const std::vector<std::string> &font_paths);
+    void SetupBenchmark(uint16_t texture_size, const std::vector<uint32_t> &pixel_sizes, uint16_t glyph_padding);
+    std::vector<PackingResult> RunBenchmark(const std::vector<RectanglePackerType::Enum> &packer_types);
+
+    [[nodiscard]] uint32_t GetGlyphCount() const {
+        return (uint32_t) glyph_sizes_.size();
+    }
+
+private:
+    struct GlyphSize {
+        uint16_t width, height;
+    };
+
+    void CollectGlyphSizes(const std::string &font_path);
+    PackingResult Replay(RectanglePackerType::Enum packer_type) const;
+
+    std::vector<std::string> font_paths_;
+    std::vector<GlyphSize> glyph_sizes_;
+
+    uint16_t texture_size_ = 1024;
+    std::vector<uint32_t> pixel_sizes_;
+    uint16_t glyph_padding_ = 0;
+};
@@ -6,6 +6,7 @@
 #include "GlyphGenerationBenchmark.h"
 #include "GlyphRenderingBenchmark.h"
 #include "GlyphErrorBenchmark.h"
+#include "PackingBenchmark.h"
 
 const int k_window_width_ = 1000;
 const int k_window_height_ = 1000;
@@ -65,12 +66,37 @@ void BenchmarkGlyphError() {
     glyph_error_benchmark.RunBenchmark();
 }
 
+void BenchmarkPacking() {
+    auto packing_benchmark = PackingBenchmark({"../assets/fonts/OpenSans-Regular.ttf", "../assets/fonts/OpenSans-Bold.ttf",
+                                               "../assets/fonts/droidsans.ttf", "../assets/fonts/Helvetica-Bold.ttf"});
+    packing_benchmark.SetupBenchmark(1024, {16, 32, 64}, 2);
+
+    const auto packer_types = std::vector<RectanglePackerType::Enum>{RectanglePackerType::Skyline, RectanglePackerType::MaxRects};
+    const char *packer_names[] = {"Skyline", "MaxRects"};
+    auto results = packing_benchmark.RunBenchmark(packer_types);
+
+    PrintGreen(("Packing Results (" + std::to_string(packing_benchmark.GetGlyphCount()) + " glyphs)").c_str());
+    for (int i = 0; i < results.size(); i++) {
+        std::string str = packer_names[i];
+        str.append(" used ");
+        str.append(std::to_string(results[i].face_count));
+        str.append(" faces, occupancy ");
+        str.append(std::to_string(results[i].occupancy * 100.0));
+        str.append(" %, ");
+        str.append(std::to_string(results[i].insert_time_us));
+        str.append(" us / insert.");
+
+        PrintGreen(str.c_str());
+    }
+}
+
 int main() {
     window_ = new Window(k_window_width_, k_window_height_, "Benchmark");
     Setup();
 
 //    BenchmarkGlyphGeneration();
 //    BenchmarkGlyphRendering();
+//    BenchmarkPacking();
     BenchmarkGlyphError();
 
     Shutdown();
@@ -5,25 +5,41 @@
 #include <algorithm>
 #include <cmath>
 #include "EdgeSegment.h"
+#include "ShapeArena.h"
 #include "../helper/EquationSolver.h"
 #include "../utilities.h"
 
 #define PI 3.14159265359
 
 // edge segment -------------------------------------
-EdgeSegment *EdgeSegment::CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1) {
-    return new LinearSegment(p0, p1);
+template<typename T, typename... Args>
+static EdgeSegment *NewEdgeSegment(ShapeArena *arena, const Args &... args) {
+    if (arena != nullptr) return arena->Create<T>(args...);
+    return new T(args...);
 }
 
-EdgeSegment *EdgeSegment::CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2) {
-    if ((p1 - p0).Cross(p2 - p1) == 0) return new LinearSegment(p0, p2); // cross product is zero for parallel vectors
-    return new QuadraticSegment(p0, p1, p2);
+template<size_t N>
+static void GetPointsBounds(const Vector2 (&points)[N], Vector2 &min, Vector2 &max) {
+    min = max = points[0];
+    for (size_t i = 1; i < N; i++) {
+        min = Vector2(std::min(min.x, points[i].x), std::min(min.y, points[i].y));
+        max = Vector2(std::max(max.x, points[i].x), std::max(max.y, points[i].y));
+    }
+}
+
+EdgeSegment *EdgeSegment::CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1, ShapeArena *arena) {
+    return NewEdgeSegment<LinearSegment>(arena, p0, p1);
 }
 
-EdgeSegment *EdgeSegment::CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2, const Vector2 &p3) {
-    if ((p1 - p0).Cross(p2 - p1) == 0 && (p2 - p1).Cross(p3 - p2) == 0) return new LinearSegment(p0, p3);
-    if (p1 * 1.5 - p0 * 0.5 == p2 * 1.5 - p3 * 0.5) return new QuadraticSegment(p0, p2 - p1, p3);
-    return new CubicSegment(p0, p1, p2, p3);
+EdgeSegment *EdgeSegment::CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2, ShapeArena *arena) {
+    if ((p1 - p0).Cross(p2 - p1) == 0) return NewEdgeSegment<LinearSegment>(arena, p0, p2); // cross product is zero for parallel vectors
+    return NewEdgeSegment<QuadraticSegment>(arena, p0, p1, p2);
+}
+
+EdgeSegment *EdgeSegment::CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2, const Vector2 &p3, ShapeArena *arena) {
+    if ((p1 - p0).Cross(p2 - p1) == 0 && (p2 - p1).Cross(p3 - p2) == 0) return NewEdgeSegment<LinearSegment>(arena, p0, p3);
+    if (p1 * 1.5 - p0 * 0.5 == p2 * 1.5 - p3 * 0.5) return NewEdgeSegment<QuadraticSegment>(arena, p0, p2 - p1, p3);
+    return NewEdgeSegment<CubicSegment>(arena, p0, p1, p2, p3);
 }
 
 double EdgeSegment::SignedDistance(const Vector2 &p, double &t) const {
@@ -91,6 +107,10 @@ Vector2 LinearSegment::GetDirection(double t) const {
     return (points_[1] - points_[0]).Normalize();
 }
 
+void LinearSegment::GetBounds(Vector2 &min, Vector2 &max) const {
+    GetPointsBounds(points_, min, max);
+}
+
 double LinearSegment::SignedPseudoDistance(const Vector2 &p, double &t) const {
     t = (p - points_[0]) * (points_[1] - points_[0]) / (points_[1] - points_[0]).Length2();
 
@@ -162,6 +182,10 @@ Vector2 QuadraticSegment::GetDirection(double t) const {
     return direction.Normalize();
 }
 
+void QuadraticSegment::GetBounds(Vector2 &min, Vector2 &max) const {
+    GetPointsBounds(points_, min, max);
+}
+
 std::vector<double> QuadraticSegment::CandidateTValues(const Vector2 &p) const {
     // helper variables
     const auto p0 = p - points_[0];
@@ -244,6 +268,10 @@ Vector2 CubicSegment::GetDirection(double t) const {
     return direction.Normalize();
 }
 
+void CubicSegment::GetBounds(Vector2 &min, Vector2 &max) const {
+    GetPointsBounds(points_, min, max);
+}
+
 std::vector<double> CubicSegment::CandidateTValues(const Vector2 &p) const {
     // helper variables
     const auto p0 = p - points_[0];
@@ -7,16 +7,18 @@
 #include "Vector2.h"
 #include <vector>
 
+class ShapeArena;
+
 enum class EdgeColor {
     Black, Red, Green, Yellow, Blue, Magenta, Cyan, White
 };
 
 class EdgeSegment {
 public:
-    // constructors
-    static EdgeSegment *CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1);
-    static EdgeSegment *CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2);
-    static EdgeSegment *CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2, const Vector2 &p3);
+    // constructors (if an arena is given the segment is allocated inside it and released with the arena)
+    static EdgeSegment *CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1, ShapeArena *arena = nullptr);
+    static EdgeSegment *CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2, ShapeArena *arena = nullptr);
+    static EdgeSegment *CreateEdgeSegment(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2, const Vector2 &p3, ShapeArena *arena = nullptr);
 
     virtual ~EdgeSegment() = default;
 
@@ -28,6 +30,8 @@ public:
     
     [[nodiscard]] virtual Vector2 GetPoint(double t) const = 0;
     [[nodiscard]] virtual Vector2 GetDirection(double t) const = 0;
+    /// axis aligned box of the control points, the segment never leaves it
+    virtual void GetBounds(Vector2 &min, Vector2 &max) const = 0;
     [[nodiscard]] virtual double GetOrthogonality(const Vector2 &p, double t) const;
     [[nodiscard]] static double GetAngleDeg(const EdgeSegment* edge1, const EdgeSegment* edge2, double t1, double t2);
     
@@ -46,6 +50,7 @@ public:
 
     [[nodiscard]] Vector2 GetPoint(double t) const override;
     [[nodiscard]] Vector2 GetDirection(double t) const override;
+    void GetBounds(Vector2 &min, Vector2 &max) const override;
 
     virtual std::string ToString() const;
 };
@@ -60,6 +65,7 @@ public:
 
     [[nodiscard]] Vector2 GetPoint(double t) const override;
     [[nodiscard]] Vector2 GetDirection(double t) const override;
+    void GetBounds(Vector2 &min, Vector2 &max) const override;
 
     virtual std::string ToString() const;
     
@@ -77,6 +83,7 @@ public:
 
     [[nodiscard]] Vector2 GetPoint(double t) const override;
     [[nodiscard]] Vector2 GetDirection(double t) const override;
+    void GetBounds(Vector2 &min, Vector2 &max) const override;
     
     virtual std::string ToString() const;
     
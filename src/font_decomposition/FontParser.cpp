@@ -7,20 +7,36 @@
 #include <freetype/ftimage.h>
 #include "Contour.h"
 #include "Shape.h"
+#include "ShapeArena.h"
 #include "../utilities.h"
 
-Shape FontParser::ParseFtFace(CodePoint code_point, FT_Face* face, double scale) {
+Shape FontParser::ParseFtFace(CodePoint code_point, FT_Face* face, double scale, ShapeArena* arena) {
     auto glyph_index = FT_Get_Char_Index(*face, code_point);
+    return ParseFtGlyph(glyph_index, face, scale, arena);
+}
+
+Shape FontParser::ParseFtGlyph(uint32_t glyph_index, FT_Face* face, double scale, ShapeArena* arena) {
     if (FT_Load_Glyph(*face, glyph_index, FT_LOAD_NO_SCALE)) {
         PrintError("Failed to load glyph");
         return {};
     }
 
+    return ParseFtOutline((*face)->glyph->outline, scale, arena);
+}
+
+Shape FontParser::ParseFtOutline(const FT_Outline& outline, double scale, ShapeArena* arena) {
     Shape output{};
+    output.contours.reserve(outline.n_contours);
+    if (arena) {
+        // every point of the outline produces at most one edge
+        arena->Reserve(outline.n_points * sizeof(CubicSegment));
+    }
 
     FtContext context{};
     context.scale = scale;
     context.shape = &output;
+    context.arena = arena;
+    context.outline = &outline;
 
     FT_Outline_Funcs_ ft_functions{};
     ft_functions.move_to = &FtMoveTo;
@@ -30,15 +46,24 @@ Shape FontParser::ParseFtFace(CodePoint code_point, FT_Face* face, double scale)
     ft_functions.shift = 0;
     ft_functions.delta = 0;
 
-    FT_Outline_Decompose(&(*face)->glyph->outline, &ft_functions, &context);
+    FT_Outline_Decompose(const_cast<FT_Outline *>(&outline), &ft_functions, &context);
 
     return output;
 }
 
+int FontParser::GetContourPointCount(const FT_Outline &outline, int contour_index) {
+    if (contour_index < 0 || contour_index >= outline.n_contours) return 0;
+
+    const int first_point = contour_index == 0 ? 0 : outline.contours[contour_index - 1] + 1;
+    return outline.contours[contour_index] - first_point + 1;
+}
+
 int FontParser::FtMoveTo(const FT_Vector *to, void *user) {
     auto context = reinterpret_cast<FtContext *>(user);
     if (!context->contour || context->contour->HasEdges()) {
         context->contour = &context->shape->AddEmptyContour();
+        const auto contour_index = (int) context->shape->contours.size() - 1;
+        context->contour->edges.reserve(GetContourPointCount(*context->outline, contour_index));
     }
     context->position = Point2(*to, context->scale);
     return 0;
@@ -48,7 +73,7 @@ int FontParser::FtLineTo(const FT_Vector *to, void *user) {
     auto context = reinterpret_cast<FtContext *>(user);
     auto end_point = Point2(*to, context->scale);
     if (end_point != context->position) {
-        context->contour->AddEdge(EdgeHolder(context->position, end_point));
+        context->contour->AddEdge(EdgeHolder(EdgeSegment::CreateEdgeSegment(context->position, end_point, context->arena)));
         context->position = end_point;
     }
 
@@ -60,7 +85,7 @@ int FontParser::FtConicTo(const FT_Vector *control, const FT_Vector *to, void *u
     auto control_point = Point2(*control, context->scale);
     auto end_point = Point2(*to, context->scale);
     if (end_point != context->position) {
-        auto temp = EdgeHolder(context->position, control_point, end_point);
+        auto temp = EdgeHolder(EdgeSegment::CreateEdgeSegment(context->position, control_point, end_point, context->arena));
         context->contour->AddEdge(temp);
         context->position = end_point;
     }
@@ -74,7 +99,7 @@ int FontParser::FtCubicTo(const FT_Vector *control1, const FT_Vector *control2,
     auto control_point2 = Point2(*control2, context->scale);
     auto end_point = Point2(*to, context->scale);
     if (end_point != context->position || (control_point1 - end_point).Cross(control_point2 - end_point)) {
-        context->contour->AddEdge(EdgeHolder(context->position, control_point1, control_point2, end_point));
+        context->contour->AddEdge(EdgeHolder(EdgeSegment::CreateEdgeSegment(context->position, control_point1, control_point2, end_point, context->arena)));
         context->position = end_point;
     }
 
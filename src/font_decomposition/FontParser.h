@@ -9,12 +9,21 @@
 
 class Shape;
 class Contour;
+class ShapeArena;
 
 class FontParser {
 public:
-    static Shape ParseFtFace(CodePoint code_point, FT_Face* face, double scale = 1 / 64.0);
+    /// Decompose the outline of a glyph into a shape. If an arena is given, the edges are allocated
+    /// inside it (reserved up front from the outline point count) and are valid until the arena is reset.
+    static Shape ParseFtFace(CodePoint code_point, FT_Face* face, double scale = 1 / 64.0, ShapeArena* arena = nullptr);
+    /// Same as ParseFtFace but for an already resolved glyph index. The glyph stays loaded in the face's glyph slot.
+    static Shape ParseFtGlyph(uint32_t glyph_index, FT_Face* face, double scale = 1 / 64.0, ShapeArena* arena = nullptr);
+    /// Decompose an already loaded outline.
+    static Shape ParseFtOutline(const FT_Outline& outline, double scale = 1 / 64.0, ShapeArena* arena = nullptr);
     
 private:
+    static int GetContourPointCount(const FT_Outline& outline, int contour_index);
+
     static int FtMoveTo(const FT_Vector* to, void* user);
     static int FtLineTo(const FT_Vector* to, void* user);
     static int FtConicTo(const FT_Vector* control, const FT_Vector* to, void* user);
@@ -26,5 +35,7 @@ struct FtContext {
     Point2 position;
     Shape *shape;
     Contour *contour;
+    ShapeArena *arena;
+    const FT_Outline *outline;
 };
 
@@ -0,0 +1,43 @@
+﻿#include <freetype/ftoutln.h>
+
+#include "OutlineCache.h"
+#include "FontParser.h"
+
+OutlineCache::OutlineCache(FT_Face face, float edge_coloring_angle) : face_(face), edge_coloring_angle_(edge_coloring_angle), arena_(64 * 1024) {}
+
+const GlyphOutline *OutlineCache::GetOutline(uint32_t glyph_index, bool apply_preprocessing) {
+    const uint64_t key = ((uint64_t) glyph_index << 1) | (apply_preprocessing ? 1 : 0);
+
+    auto it = outlines_.find(key);
+    if (it != outlines_.end()) {
+        return &it->second;
+    }
+
+    GlyphOutline outline;
+    if (!LoadOutline(face_, glyph_index, apply_preprocessing, edge_coloring_angle_, &arena_, outline)) {
+        return nullptr;
+    }
+
+    // outlines are never erased, so the returned pointer stays valid until the cache is cleared
+    return &outlines_.emplace(key, std::move(outline)).first->second;
+}
+
+bool OutlineCache::LoadOutline(FT_Face face, uint32_t glyph_index, bool apply_preprocessing, float edge_coloring_angle, ShapeArena *arena, GlyphOutline &out_outline) {
+    if (FT_Load_Glyph(face, glyph_index, FT_LOAD_NO_SCALE)) {
+        return false;
+    }
+
+    out_outline.shape = FontParser::ParseFtOutline(face->glyph->outline, 1.0, arena);
+
+    if (apply_preprocessing) out_outline.shape.ApplyPreprocessing();
+    out_outline.shape.ApplyEdgeColoring(edge_coloring_angle);
+
+    FT_Outline_Get_CBox(&face->glyph->outline, &out_outline.bbox);
+    out_outline.advance = face->glyph->advance;
+    return true;
+}
+
+void OutlineCache::Clear() {
+    outlines_.clear();
+    arena_.Reset();
+}
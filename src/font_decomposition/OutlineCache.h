@@ -0,0 +1,50 @@
+﻿#pragma once
+
+#include <freetype/freetype.h>
+#include <unordered_map>
+
+#include "Shape.h"
+#include "ShapeArena.h"
+
+#define EDGE_COLORING_MAX_ANGLE 15.0f
+
+// GlyphOutline holds a decomposed glyph in font units, ready for distance field generation.
+struct GlyphOutline {
+    Shape shape;
+    FT_BBox_ bbox{};
+    FT_Vector advance{};
+};
+
+// OutlineCache stores the decomposed, preprocessed and colored outlines of a single face.
+// Outlines are in font units (FT_LOAD_NO_SCALE), so one cache can be shared between all
+// the generators created on the same face regardless of their pixel size.
+class OutlineCache {
+public:
+    explicit OutlineCache(FT_Face face, float edge_coloring_angle = EDGE_COLORING_MAX_ANGLE);
+
+    /// return the outline of a glyph, decomposing it on first use
+    /// @return nullptr if the glyph could not be loaded
+    const GlyphOutline *GetOutline(uint32_t glyph_index, bool apply_preprocessing);
+
+    /// decompose, preprocess and color a glyph without caching it
+    /// @remark the edges are allocated in the given arena and are valid until it is reset
+    static bool LoadOutline(FT_Face face, uint32_t glyph_index, bool apply_preprocessing, float edge_coloring_angle, ShapeArena *arena, GlyphOutline &out_outline);
+
+    /// release all the cached outlines
+    void Clear();
+
+    [[nodiscard]] FT_Face GetFace() const {
+        return face_;
+    }
+
+    [[nodiscard]] size_t GetOutlineCount() const {
+        return outlines_.size();
+    }
+
+private:
+    FT_Face face_;
+    float edge_coloring_angle_;
+
+    ShapeArena arena_;
+    std::unordered_map<uint64_t, GlyphOutline> outlines_;
+};
@@ -0,0 +1,82 @@
+﻿#include <algorithm>
+#include "ShapeArena.h"
+
+ShapeArena::ShapeArena(size_t block_size) : block_size_(block_size) {}
+
+ShapeArena::~ShapeArena() {
+    for (auto &block: blocks_) {
+        delete[] block.data;
+    }
+}
+
+void ShapeArena::Reserve(size_t size) {
+    // check if any of the remaining blocks can already hold the requested size
+    for (size_t i = current_block_; i < blocks_.size(); i++) {
+        const auto &block = blocks_[i];
+        if (block.size - AlignOffset(block, alignof(std::max_align_t)) >= size) {
+            current_block_ = i;
+            return;
+        }
+    }
+
+    AddBlock(size);
+}
+
+void *ShapeArena::Allocate(size_t size, size_t alignment) {
+    while (current_block_ < blocks_.size()) {
+        auto &block = blocks_[current_block_];
+        const auto offset = AlignOffset(block, alignment);
+        if (offset + size <= block.size) {
+            block.offset = offset + size;
+            return block.data + offset;
+        }
+        current_block_++;
+    }
+
+    auto &block = AddBlock(size + alignment);
+    const auto offset = AlignOffset(block, alignment);
+    block.offset = offset + size;
+    return block.data + offset;
+}
+
+void ShapeArena::Reset() {
+    for (auto &block: blocks_) {
+        block.offset = 0;
+    }
+    current_block_ = 0;
+}
+
+size_t ShapeArena::GetUsedSize() const {
+    size_t used = 0;
+    for (const auto &block: blocks_) {
+        used += block.offset;
+    }
+    return used;
+}
+
+size_t ShapeArena::GetCapacity() const {
+    size_t capacity = 0;
+    for (const auto &block: blocks_) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+size_t ShapeArena::AlignOffset(const Block &block, size_t alignment) {
+    const auto address = reinterpret_cast<uintptr_t>(block.data + block.offset);
+    const auto aligned = (address + alignment - 1) & ~(uintptr_t) (alignment - 1);
+    return block.offset + (aligned - address);
+}
+
+ShapeArena::Block &ShapeArena::AddBlock(size_t size) {
+    Block block{};
+    block.size = std::max(size, block_size_);
+    block.data = new uint8_t[block.size];
+    block.offset = 0;
+
+    // insert the new block as the current one so the remaining free blocks can still be used later
+    const auto index = std::min(current_block_, blocks_.size());
+    blocks_.insert(blocks_.begin() + (long) index, block);
+    current_block_ = index;
+    return blocks_[current_block_];
+}
@@ -0,0 +1,56 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+// ShapeArena is a simple bump allocator used while decomposing glyph outlines.
+// All the edge segments of a glyph are allocated from it and released at once
+// by calling Reset, so no per-edge delete is needed.
+// note: destructors of the allocated objects are never called, so only objects
+// that don't own any resources (like edge segments) should be allocated here.
+class ShapeArena {
+public:
+    explicit ShapeArena(size_t block_size = 16 * 1024);
+    ~ShapeArena();
+
+    ShapeArena(const ShapeArena &) = delete;
+    ShapeArena &operator=(const ShapeArena &) = delete;
+
+    /// make sure that at least the given amount of bytes can be allocated without allocating a new block
+    void Reserve(size_t size);
+
+    /// allocate a chunk of memory with the given alignment
+    void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /// allocate and construct an object of type T inside the arena
+    template<typename T, typename... Args>
+    T *Create(Args &&... args) {
+        return new(Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /// release all allocations at once, the allocated blocks are kept for reuse
+    void Reset();
+
+    /// return the number of bytes allocated since the last reset
+    [[nodiscard]] size_t GetUsedSize() const;
+
+    /// return the number of bytes owned by the arena
+    [[nodiscard]] size_t GetCapacity() const;
+
+private:
+    struct Block {
+        uint8_t *data;
+        size_t size;
+        size_t offset;
+    };
+
+    [[nodiscard]] static size_t AlignOffset(const Block &block, size_t alignment);
+    Block &AddBlock(size_t size);
+
+    std::vector<Block> blocks_;
+    size_t current_block_ = 0;
+    size_t block_size_;
+};
@@ -9,7 +9,8 @@ AtlasRegion::Type AtlasRegion::GetType() const {
 }
 
 uint32_t AtlasRegion::GetFaceIndex() const {
-    return (mask >> 4) & 0x0000000F;
+    // the low 4 bits of the face index keep their original place, the high bits are stored above the component
+    return ((mask >> 4) & 0x0000000F) | ((mask >> 12) << 4);
 }
 
 uint32_t AtlasRegion::GetComponentIndex() const {
@@ -17,5 +18,5 @@ uint32_t AtlasRegion::GetComponentIndex() const {
 }
 
 void AtlasRegion::SetMask(Type type, uint32_t face_index, uint32_t component_index) {
-    mask = (component_index << 8) + (face_index << 4) + (uint32_t) type;
+    mask = ((face_index >> 4) << 12) + (component_index << 8) + ((face_index & 0x0000000F) << 4) + (uint32_t) type;
 }
\ No newline at end of file
@@ -19,5 +19,5 @@ struct AtlasRegion {
     
     uint16_t x, y;
     uint16_t width, height;
-    uint32_t mask; //encode the region type, the face index and the component index in case of a gray region
+    uint32_t mask; //encode the region type, the face (or array layer) index and the component index in case of a gray region
 };
@@ -0,0 +1,472 @@
+﻿#include <bx/bx.h>
+#include <bx/math.h>
+#include <utility>
+
+#include "BlockCompression.h"
+
+#define BLOCK_TEXEL_COUNT (BLOCK_COMPRESSION_BLOCK_SIZE * BLOCK_COMPRESSION_BLOCK_SIZE)
+
+namespace {
+    // interpolation weights of the 4 bit bc7 indices, out of 64
+    const uint32_t BC7_WEIGHTS[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+    uint32_t SquaredDistance(const uint8_t *a, const uint8_t *b, uint32_t channels) {
+        uint32_t distance = 0;
+        for (uint32_t cc = 0; cc < channels; ++cc) {
+            const int32_t delta = (int32_t) a[cc] - (int32_t) b[cc];
+            distance += (uint32_t) (delta * delta);
+        }
+        return distance;
+    }
+
+    // the 16 texels of a block as rgba, in the texel order of the encoded indices
+    void GatherRgba(const uint8_t *texels, uint32_t pitch, uint8_t out_rgba[BLOCK_TEXEL_COUNT][4]) {
+        for (uint32_t yy = 0; yy < BLOCK_COMPRESSION_BLOCK_SIZE; ++yy) {
+            const uint8_t *row = texels + yy * pitch;
+            for (uint32_t xx = 0; xx < BLOCK_COMPRESSION_BLOCK_SIZE; ++xx) {
+                uint8_t *rgba = out_rgba[yy * BLOCK_COMPRESSION_BLOCK_SIZE + xx];
+                rgba[0] = row[xx * 4 + 2];
+                rgba[1] = row[xx * 4 + 1];
+                rgba[2] = row[xx * 4 + 0];
+                rgba[3] = row[xx * 4 + 3];
+            }
+        }
+    }
+
+    void ScatterRgba(const uint8_t rgba[BLOCK_TEXEL_COUNT][4], uint8_t *out_texels, uint32_t pitch) {
+        for (uint32_t yy = 0; yy < BLOCK_COMPRESSION_BLOCK_SIZE; ++yy) {
+            uint8_t *row = out_texels + yy * pitch;
+            for (uint32_t xx = 0; xx < BLOCK_COMPRESSION_BLOCK_SIZE; ++xx) {
+                const uint8_t *texel = rgba[yy * BLOCK_COMPRESSION_BLOCK_SIZE + xx];
+                row[xx * 4 + 0] = texel[2];
+                row[xx * 4 + 1] = texel[1];
+                row[xx * 4 + 2] = texel[0];
+                row[xx * 4 + 3] = texel[3];
+            }
+        }
+    }
+
+    // endpoints of the line through the texels along their principal axis, the channels of a
+    // msdf texel are not always correlated, so the diagonal of the bounding box is not enough
+    void FitLine(const uint8_t rgba[BLOCK_TEXEL_COUNT][4], uint32_t channels, float out_start[4], float out_end[4]) {
+        float mean[4] = {};
+        for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT; ++ii) {
+            for (uint32_t cc = 0; cc < channels; ++cc) {
+                mean[cc] += (float) rgba[ii][cc] / BLOCK_TEXEL_COUNT;
+            }
+        }
+
+        float covariance[4][4] = {};
+        for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT; ++ii) {
+            for (uint32_t aa = 0; aa < channels; ++aa) {
+                for (uint32_t bb = 0; bb < channels; ++bb) {
+                    covariance[aa][bb] += ((float) rgba[ii][aa] - mean[aa]) * ((float) rgba[ii][bb] - mean[bb]);
+                }
+            }
+        }
+
+        // power iteration, starting from the channel that varies the most
+        float axis[4] = {};
+        uint32_t widest_channel = 0;
+        for (uint32_t cc = 1; cc < channels; ++cc) {
+            if (covariance[cc][cc] > covariance[widest_channel][widest_channel]) {
+                widest_channel = cc;
+            }
+        }
+        axis[widest_channel] = 1.0f;
+
+        for (uint32_t iteration = 0; iteration < 8; ++iteration) {
+            float next[4] = {};
+            float length = 0.0f;
+            for (uint32_t aa = 0; aa < channels; ++aa) {
+                for (uint32_t bb = 0; bb < channels; ++bb) {
+                    next[aa] += covariance[aa][bb] * axis[bb];
+                }
+                length += next[aa] * next[aa];
+            }
+
+            if (length <= 0.0f) {
+                break;
+            }
+
+            length = bx::sqrt(length);
+            for (uint32_t cc = 0; cc < channels; ++cc) {
+                axis[cc] = next[cc] / length;
+            }
+        }
+
+        float min_t = 0.0f;
+        float max_t = 0.0f;
+        for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT; ++ii) {
+            float t = 0.0f;
+            for (uint32_t cc = 0; cc < channels; ++cc) {
+                t += ((float) rgba[ii][cc] - mean[cc]) * axis[cc];
+            }
+            min_t = bx::min(min_t, t);
+            max_t = bx::max(max_t, t);
+        }
+
+        for (uint32_t cc = 0; cc < channels; ++cc) {
+            out_start[cc] = bx::clamp(mean[cc] + axis[cc] * min_t, 0.0f, 255.0f);
+            out_end[cc] = bx::clamp(mean[cc] + axis[cc] * max_t, 0.0f, 255.0f);
+        }
+    }
+
+    uint16_t ToRgb565(const float rgb[3]) {
+        const auto r = (uint16_t) (rgb[0] * 31.0f / 255.0f + 0.5f);
+        const auto g = (uint16_t) (rgb[1] * 63.0f / 255.0f + 0.5f);
+        const auto b = (uint16_t) (rgb[2] * 31.0f / 255.0f + 0.5f);
+        return (uint16_t) (r << 11 | g << 5 | b);
+    }
+
+    void FromRgb565(uint16_t color, uint8_t out_rgba[4]) {
+        const uint32_t r = (color >> 11) & 0x1f;
+        const uint32_t g = (color >> 5) & 0x3f;
+        const uint32_t b = color & 0x1f;
+        out_rgba[0] = (uint8_t) (r << 3 | r >> 2);
+        out_rgba[1] = (uint8_t) (g << 2 | g >> 4);
+        out_rgba[2] = (uint8_t) (b << 3 | b >> 2);
+        out_rgba[3] = 255;
+    }
+
+    void Bc1Palette(uint16_t color0, uint16_t color1, uint8_t out_palette[4][4]) {
+        FromRgb565(color0, out_palette[0]);
+        FromRgb565(color1, out_palette[1]);
+        for (uint32_t cc = 0; cc < 3; ++cc) {
+            const uint32_t c0 = out_palette[0][cc];
+            const uint32_t c1 = out_palette[1][cc];
+            if (color0 > color1) {
+                out_palette[2][cc] = (uint8_t) ((2 * c0 + c1 + 1) / 3);
+                out_palette[3][cc] = (uint8_t) ((c0 + 2 * c1 + 1) / 3);
+            } else {
+                out_palette[2][cc] = (uint8_t) ((c0 + c1 + 1) / 2);
+                out_palette[3][cc] = 0;
+            }
+        }
+        out_palette[2][3] = 255;
+        out_palette[3][3] = color0 > color1 ? 255 : 0;
+    }
+
+    void Bc4Palette(uint8_t red0, uint8_t red1, uint8_t out_palette[8]) {
+        out_palette[0] = red0;
+        out_palette[1] = red1;
+        if (red0 > red1) {
+            for (uint32_t ii = 1; ii < 7; ++ii) {
+                out_palette[ii + 1] = (uint8_t) (((7 - ii) * red0 + ii * red1 + 3) / 7);
+            }
+        } else {
+            for (uint32_t ii = 1; ii < 5; ++ii) {
+                out_palette[ii + 1] = (uint8_t) (((5 - ii) * red0 + ii * red1 + 2) / 5);
+            }
+            out_palette[6] = 0;
+            out_palette[7] = 255;
+        }
+    }
+
+    // bits of a bc7 block, least significant bit first
+    struct BitWriter {
+        uint8_t *data;
+        uint32_t position;
+
+        void Write(uint32_t value, uint32_t bit_count) {
+            for (uint32_t ii = 0; ii < bit_count; ++ii, ++position) {
+                if ((value >> ii) & 1) {
+                    data[position / 8] |= (uint8_t) (1 << (position % 8));
+                }
+            }
+        }
+    };
+
+    struct BitReader {
+        const uint8_t *data;
+        uint32_t position;
+
+        uint32_t Read(uint32_t bit_count) {
+            uint32_t value = 0;
+            for (uint32_t ii = 0; ii < bit_count; ++ii, ++position) {
+                value |= (uint32_t) ((data[position / 8] >> (position % 8)) & 1) << ii;
+            }
+            return value;
+        }
+    };
+
+    void Bc7Palette(const uint8_t endpoints[2][4], uint8_t out_palette[16][4]) {
+        for (uint32_t ii = 0; ii < 16; ++ii) {
+            for (uint32_t cc = 0; cc < 4; ++cc) {
+                out_palette[ii][cc] = (uint8_t) (((64 - BC7_WEIGHTS[ii]) * endpoints[0][cc] + BC7_WEIGHTS[ii] * endpoints[1][cc] + 32) >> 6);
+            }
+        }
+    }
+
+    // quantize an endpoint to 7 bits per channel and the shared p-bit that reconstructs it best
+    void QuantizeBc7Endpoint(const float endpoint[4], uint8_t out_quantized[4], uint8_t &out_p_bit) {
+        uint32_t best_error = UINT32_MAX;
+        for (uint8_t p_bit = 0; p_bit < 2; ++p_bit) {
+            uint8_t quantized[4];
+            uint32_t error = 0;
+            for (uint32_t cc = 0; cc < 4; ++cc) {
+                const int32_t value = (int32_t) ((endpoint[cc] - (float) p_bit) / 2.0f + 0.5f);
+                quantized[cc] = (uint8_t) bx::clamp(value, 0, 127);
+                const int32_t delta = (int32_t) (quantized[cc] << 1 | p_bit) - (int32_t) (endpoint[cc] + 0.5f);
+                error += (uint32_t) (delta * delta);
+            }
+
+            if (error < best_error) {
+                best_error = error;
+                out_p_bit = p_bit;
+                bx::memCopy(out_quantized, quantized, sizeof(quantized));
+            }
+        }
+    }
+
+    // quantize the endpoints of a line, pick the closest palette entry for every texel and return the squared error
+    uint32_t FitBc7Indices(const float line[2][4], const uint8_t rgba[BLOCK_TEXEL_COUNT][4], uint8_t out_quantized[2][4],
+                           uint8_t out_p_bits[2], uint32_t out_indices[BLOCK_TEXEL_COUNT]) {
+        uint8_t endpoints[2][4];
+        for (uint32_t ee = 0; ee < 2; ++ee) {
+            QuantizeBc7Endpoint(line[ee], out_quantized[ee], out_p_bits[ee]);
+            for (uint32_t cc = 0; cc < 4; ++cc) {
+                endpoints[ee][cc] = (uint8_t) (out_quantized[ee][cc] << 1 | out_p_bits[ee]);
+            }
+        }
+
+        uint8_t palette[16][4];
+        Bc7Palette(endpoints, palette);
+
+        uint32_t total_error = 0;
+        for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT; ++ii) {
+            uint32_t best_error = UINT32_MAX;
+            for (uint32_t index = 0; index < 16; ++index) {
+                const uint32_t error = SquaredDistance(rgba[ii], palette[index], 4);
+                if (error < best_error) {
+                    best_error = error;
+                    out_indices[ii] = index;
+                }
+            }
+            total_error += best_error;
+        }
+        return total_error;
+    }
+
+    // least squares endpoints for fixed indices, false if all the texels use the same weight
+    bool SolveBc7Endpoints(const uint8_t rgba[BLOCK_TEXEL_COUNT][4], const uint32_t indices[BLOCK_TEXEL_COUNT], float out_line[2][4]) {
+        float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+        float start_sum[4] = {};
+        float end_sum[4] = {};
+        for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT; ++ii) {
+            const float weight = (float) BC7_WEIGHTS[indices[ii]] / 64.0f;
+            aa += (1.0f - weight) * (1.0f - weight);
+            ab += (1.0f - weight) * weight;
+            bb += weight * weight;
+            for (uint32_t cc = 0; cc < 4; ++cc) {
+                start_sum[cc] += (1.0f - weight) * (float) rgba[ii][cc];
+                end_sum[cc] += weight * (float) rgba[ii][cc];
+            }
+        }
+
+        const float determinant = aa * bb - ab * ab;
+        if (bx::abs(determinant) < 1e-6f) {
+            return false;
+        }
+
+        for (uint32_t cc = 0; cc < 4; ++cc) {
+            out_line[0][cc] = bx::clamp((bb * start_sum[cc] - ab * end_sum[cc]) / determinant, 0.0f, 255.0f);
+            out_line[1][cc] = bx::clamp((aa * end_sum[cc] - ab * start_sum[cc]) / determinant, 0.0f, 255.0f);
+        }
+        return true;
+    }
+}
+
+void EncodeBlockBc4(const uint8_t *texels, uint32_t pitch, uint8_t *out_block) {
+    uint8_t values[BLOCK_TEXEL_COUNT];
+    uint8_t min_value = 255;
+    uint8_t max_value = 0;
+    for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT; ++ii) {
+        values[ii] = texels[(ii / BLOCK_COMPRESSION_BLOCK_SIZE) * pitch + ii % BLOCK_COMPRESSION_BLOCK_SIZE];
+        min_value = bx::min(min_value, values[ii]);
+        max_value = bx::max(max_value, values[ii]);
+    }
+
+    // red0 > red1 selects the 8 value palette, a flat block uses the 6 value one with every index at 0
+    uint8_t palette[8];
+    Bc4Palette(max_value, min_value, palette);
+
+    uint64_t indices = 0;
+    for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT && max_value > min_value; ++ii) {
+        uint32_t best_index = 0;
+        uint32_t best_error = UINT32_MAX;
+        for (uint32_t index = 0; index < 8; ++index) {
+            const uint32_t error = SquaredDistance(&values[ii], &palette[index], 1);
+            if (error < best_error) {
+                best_error = error;
+                best_index = index;
+            }
+        }
+        indices |= (uint64_t) best_index << (3 * ii);
+    }
+
+    out_block[0] = max_value;
+    out_block[1] = min_value;
+    for (uint32_t ii = 0; ii < 6; ++ii) {
+        out_block[2 + ii] = (uint8_t) (indices >> (8 * ii));
+    }
+}
+
+void DecodeBlockBc4(const uint8_t *block, uint8_t *out_texels, uint32_t pitch) {
+    uint8_t palette[8];
+    Bc4Palette(block[0], block[1], palette);
+
+    uint64_t indices = 0;
+    for (uint32_t ii = 0; ii < 6; ++ii) {
+        indices |= (uint64_t) block[2 + ii] << (8 * ii);
+    }
+
+    for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT; ++ii) {
+        out_texels[(ii / BLOCK_COMPRESSION_BLOCK_SIZE) * pitch + ii % BLOCK_COMPRESSION_BLOCK_SIZE] = palette[(indices >> (3 * ii)) & 0x7];
+    }
+}
+
+void EncodeBlockBc1(const uint8_t *texels, uint32_t pitch, uint8_t *out_block) {
+    uint8_t rgba[BLOCK_TEXEL_COUNT][4];
+    GatherRgba(texels, pitch, rgba);
+
+    float start[4];
+    float end[4];
+    FitLine(rgba, 3, start, end);
+
+    // the four color palette needs color0 > color1
+    uint16_t color0 = ToRgb565(end);
+    uint16_t color1 = ToRgb565(start);
+    if (color0 < color1) {
+        std::swap(color0, color1);
+    }
+
+    uint8_t palette[4][4];
+    Bc1Palette(color0, color1, palette);
+
+    uint32_t indices = 0;
+    for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT && color0 != color1; ++ii) {
+        uint32_t best_index = 0;
+        uint32_t best_error = UINT32_MAX;
+        for (uint32_t index = 0; index < 4; ++index) {
+            const uint32_t error = SquaredDistance(rgba[ii], palette[index], 3);
+            if (error < best_error) {
+                best_error = error;
+                best_index = index;
+            }
+        }
+        indices |= best_index << (2 * ii);
+    }
+
+    out_block[0] = (uint8_t) color0;
+    out_block[1] = (uint8_t) (color0 >> 8);
+    out_block[2] = (uint8_t) color1;
+    out_block[3] = (uint8_t) (color1 >> 8);
+    for (uint32_t ii = 0; ii < 4; ++ii) {
+        out_block[4 + ii] = (uint8_t) (indices >> (8 * ii));
+    }
+}
+
+void DecodeBlockBc1(const uint8_t *block, uint8_t *out_texels, uint32_t pitch) {
+    const auto color0 = (uint16_t) (block[0] | block[1] << 8);
+    const auto color1 = (uint16_t) (block[2] | block[3] << 8);
+    const uint32_t indices = block[4] | block[5] << 8 | block[6] << 16 | (uint32_t) block[7] << 24;
+
+    uint8_t palette[4][4];
+    Bc1Palette(color0, color1, palette);
+
+    uint8_t rgba[BLOCK_TEXEL_COUNT][4];
+    for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT; ++ii) {
+        bx::memCopy(rgba[ii], palette[(indices >> (2 * ii)) & 0x3], 4);
+    }
+    ScatterRgba(rgba, out_texels, pitch);
+}
+
+void EncodeBlockBc7(const uint8_t *texels, uint32_t pitch, uint8_t *out_block) {
+    uint8_t rgba[BLOCK_TEXEL_COUNT][4];
+    GatherRgba(texels, pitch, rgba);
+
+    float line[2][4];
+    FitLine(rgba, 4, line[0], line[1]);
+
+    uint8_t quantized[2][4];
+    uint8_t p_bits[2];
+    uint32_t indices[BLOCK_TEXEL_COUNT];
+    uint32_t error = FitBc7Indices(line, rgba, quantized, p_bits, indices);
+
+    // texels that don't lie on a line (msdf corners) are fitted better by the least squares endpoints of the indices
+    for (uint32_t iteration = 0; iteration < 2 && error > 0; ++iteration) {
+        float refined_line[2][4];
+        if (!SolveBc7Endpoints(rgba, indices, refined_line)) {
+            break;
+        }
+
+        uint8_t refined_quantized[2][4];
+        uint8_t refined_p_bits[2];
+        uint32_t refined_indices[BLOCK_TEXEL_COUNT];
+        const uint32_t refined_error = FitBc7Indices(refined_line, rgba, refined_quantized, refined_p_bits, refined_indices);
+        if (refined_error >= error) {
+            break;
+        }
+
+        error = refined_error;
+        bx::memCopy(quantized, refined_quantized, sizeof(quantized));
+        bx::memCopy(p_bits, refined_p_bits, sizeof(p_bits));
+        bx::memCopy(indices, refined_indices, sizeof(indices));
+    }
+
+    // the most significant bit of the first index is implicitly 0, swap the endpoints to keep it so
+    if (indices[0] >= 8) {
+        for (uint32_t cc = 0; cc < 4; ++cc) {
+            std::swap(quantized[0][cc], quantized[1][cc]);
+        }
+        std::swap(p_bits[0], p_bits[1]);
+        for (uint32_t &index: indices) {
+            index = 15 - index;
+        }
+    }
+
+    bx::memSet(out_block, 0, 16);
+    BitWriter writer{out_block, 0};
+    writer.Write(1 << 6, 7);
+    for (uint32_t cc = 0; cc < 4; ++cc) {
+        writer.Write(quantized[0][cc], 7);
+        writer.Write(quantized[1][cc], 7);
+    }
+    writer.Write(p_bits[0], 1);
+    writer.Write(p_bits[1], 1);
+    for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT; ++ii) {
+        writer.Write(indices[ii], ii == 0 ? 3 : 4);
+    }
+}
+
+void DecodeBlockBc7(const uint8_t *block, uint8_t *out_texels, uint32_t pitch) {
+    uint8_t rgba[BLOCK_TEXEL_COUNT][4] = {};
+
+    BitReader reader{block, 0};
+    if (reader.Read(7) != 1 << 6) {
+        BX_WARN(false, "Only mode 6 BC7 blocks can be decoded")
+        ScatterRgba(rgba, out_texels, pitch);
+        return;
+    }
+
+    uint8_t endpoints[2][4];
+    for (uint32_t cc = 0; cc < 4; ++cc) {
+        endpoints[0][cc] = (uint8_t) (reader.Read(7) << 1);
+        endpoints[1][cc] = (uint8_t) (reader.Read(7) << 1);
+    }
+    const uint32_t p_bit0 = reader.Read(1);
+    const uint32_t p_bit1 = reader.Read(1);
+    for (uint32_t cc = 0; cc < 4; ++cc) {
+        endpoints[0][cc] |= p_bit0;
+        endpoints[1][cc] |= p_bit1;
+    }
+
+    uint8_t palette[16][4];
+    Bc7Palette(endpoints, palette);
+
+    for (uint32_t ii = 0; ii < BLOCK_TEXEL_COUNT; ++ii) {
+        bx::memCopy(rgba[ii], palette[reader.Read(ii == 0 ? 3 : 4)], 4);
+    }
+    ScatterRgba(rgba, out_texels, pitch);
+}
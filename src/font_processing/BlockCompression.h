@@ -0,0 +1,23 @@
+﻿#pragma once
+
+#include <cstdint>
+
+// CPU encoders (and decoders, to measure the quality) of the block compressed formats used by a compressed atlas.
+// Every function works on a single 4x4 block of texels, read or written row by row with the given pitch in bytes.
+// The encoders fit one line per block between the extremes of the texels, which suits the smooth gradients
+// of distance fields, they are not meant for general images.
+
+#define BLOCK_COMPRESSION_BLOCK_SIZE 4
+
+/// encode 16 single channel texels to an 8 byte BC4 (unsigned) block
+void EncodeBlockBc4(const uint8_t *texels, uint32_t pitch, uint8_t *out_block);
+void DecodeBlockBc4(const uint8_t *block, uint8_t *out_texels, uint32_t pitch);
+
+/// encode 16 BGRA8 texels to an 8 byte BC1 block, the alpha channel is dropped
+void EncodeBlockBc1(const uint8_t *texels, uint32_t pitch, uint8_t *out_block);
+void DecodeBlockBc1(const uint8_t *block, uint8_t *out_texels, uint32_t pitch);
+
+/// encode 16 BGRA8 texels to a 16 byte BC7 block, always in mode 6 (one subset, 7 bit endpoints and 4 bit indices)
+void EncodeBlockBc7(const uint8_t *texels, uint32_t pitch, uint8_t *out_block);
+/// @remark only decodes the mode 6 blocks written by EncodeBlockBc7
+void DecodeBlockBc7(const uint8_t *block, uint8_t *out_texels, uint32_t pitch);
@@ -6,41 +6,152 @@
 #include <bgfx/bgfx.h>
 #include <bx/bx.h>
 
+#include <algorithm>
 #include <vector>
 
+#include "BlockCompression.h"
 #include "CubeAtlas.h"
 #include "RectanglePacker.h"
 
+// layers of a texture array atlas before it grows for the first time
+#define INITIAL_ARRAY_LAYER_COUNT 2
+
+static bgfx::TextureFormat::Enum GetTextureFormat(AtlasFormat::Enum format) {
+    switch (format) {
+        case AtlasFormat::Bc1:
+            return bgfx::TextureFormat::BC1;
+        case AtlasFormat::Bc4:
+            return bgfx::TextureFormat::BC4;
+        case AtlasFormat::Bc7:
+            return bgfx::TextureFormat::BC7;
+        default:
+            return bgfx::TextureFormat::BGRA8;
+    }
+}
+
+// encode a region to the blocks covering it, the texels past its right and bottom edge repeat the last column and row
+static void EncodeBlocks(AtlasFormat::Enum format, uint16_t width, uint16_t height, const uint8_t *bitmap_buffer,
+                         AtlasRegion::Type type, uint8_t *out_line_buffer, uint32_t out_pitch) {
+    const uint32_t in_texel_size = type == AtlasRegion::TypeBgra8 ? 4 : 1;
+    const uint32_t block_bytes = format == AtlasFormat::Bc7 ? 16 : 8;
+    uint8_t texels[BLOCK_COMPRESSION_BLOCK_SIZE * BLOCK_COMPRESSION_BLOCK_SIZE * 4];
+
+    for (uint16_t block_y = 0; block_y < height; block_y += BLOCK_COMPRESSION_BLOCK_SIZE) {
+        uint8_t *out_block = out_line_buffer;
+        for (uint16_t block_x = 0; block_x < width; block_x += BLOCK_COMPRESSION_BLOCK_SIZE) {
+            for (uint32_t yy = 0; yy < BLOCK_COMPRESSION_BLOCK_SIZE; ++yy) {
+                for (uint32_t xx = 0; xx < BLOCK_COMPRESSION_BLOCK_SIZE; ++xx) {
+                    const uint32_t in_x = bx::min<uint32_t>(block_x + xx, width - 1);
+                    const uint32_t in_y = bx::min<uint32_t>(block_y + yy, height - 1);
+                    const uint8_t *in_texel = bitmap_buffer + (in_y * width + in_x) * in_texel_size;
+                    const uint32_t texel_index = yy * BLOCK_COMPRESSION_BLOCK_SIZE + xx;
+
+                    if (format == AtlasFormat::Bc4) {
+                        // the single channel decodes to red, which is where a bgra region keeps it too
+                        texels[texel_index] = in_texel_size == 4 ? in_texel[2] : in_texel[0];
+                    } else if (in_texel_size == 4) {
+                        bx::memCopy(texels + texel_index * 4, in_texel, 4);
+                    } else {
+                        // a gray texel on the line between black and white compresses without color error
+                        texels[texel_index * 4 + 0] = in_texel[0];
+                        texels[texel_index * 4 + 1] = in_texel[0];
+                        texels[texel_index * 4 + 2] = in_texel[0];
+                        texels[texel_index * 4 + 3] = 0;
+                    }
+                }
+            }
+
+            switch (format) {
+                case AtlasFormat::Bc1:
+                    EncodeBlockBc1(texels, BLOCK_COMPRESSION_BLOCK_SIZE * 4, out_block);
+                    break;
+                case AtlasFormat::Bc4:
+                    EncodeBlockBc4(texels, BLOCK_COMPRESSION_BLOCK_SIZE, out_block);
+                    break;
+                default:
+                    EncodeBlockBc7(texels, BLOCK_COMPRESSION_BLOCK_SIZE * 4, out_block);
+                    break;
+            }
+            out_block += block_bytes;
+        }
+        out_line_buffer += out_pitch;
+    }
+}
+
 struct Atlas::PackedLayer {
-    RectanglePacker packer;
+    ~PackedLayer() {
+        delete packer;
+    }
+
+    RectanglePacker *packer = nullptr;
     AtlasRegion face_region{};
 };
 
-Atlas::Atlas(uint16_t texture_size, uint16_t max_regions_count) : used_layers_(0), used_faces_(0), texture_size_(texture_size), region_count_(0), max_region_count_(max_regions_count) {
+Atlas::Atlas(uint16_t texture_size, uint16_t max_regions_count, AtlasTextureType::Enum texture_type, uint16_t max_layer_count,
+             RectanglePackerType::Enum packer_type, bool cpu_mirror, AtlasFormat::Enum format)
+        : used_layers_(0), used_faces_(0), texture_type_(texture_type), packer_type_(packer_type), format_(format),
+          texture_format_(GetTextureFormat(format)), texture_size_(texture_size), region_count_(0), max_region_count_(max_regions_count) {
     BX_ASSERT(texture_size >= 64 && texture_size <= 4096, "Invalid _textureSize %d.", texture_size)
     BX_ASSERT(max_regions_count >= 64 && max_regions_count <= 32000, "Invalid _maxRegionsCount %d.", max_regions_count)
 
     texel_size_ = float(UINT16_MAX) / float(texture_size_);
 
-    layers_ = new PackedLayer[6]; // number of layers is arbitrary
-    for (int ii = 0; ii < 6; ++ii) {
-        layers_[ii].packer.Init(texture_size, texture_size);
+    if (format_ == AtlasFormat::Bgra8) {
+        block_size_ = 1;
+        block_bytes_ = 4;
+    } else {
+        BX_ASSERT(texture_size % BLOCK_COMPRESSION_BLOCK_SIZE == 0, "Invalid _textureSize %d for a compressed atlas.", texture_size)
+        block_size_ = BLOCK_COMPRESSION_BLOCK_SIZE;
+        block_bytes_ = format_ == AtlasFormat::Bc7 ? 16 : 8;
     }
 
+    const uint16_t format_caps = bgfx::getCaps()->formats[texture_format_];
+    BX_ASSERT(0 != (format_caps & (texture_type_ == AtlasTextureType::Array ? BGFX_CAPS_FORMAT_TEXTURE_2D : BGFX_CAPS_FORMAT_TEXTURE_CUBE)),
+              "The atlas format is not supported by the renderer")
+    BX_UNUSED(format_caps)
+
+    if (texture_type_ == AtlasTextureType::Array) {
+        const bgfx::Caps *caps = bgfx::getCaps();
+        BX_ASSERT(0 != (caps->supported & BGFX_CAPS_TEXTURE_2D_ARRAY), "Texture arrays are not supported by the renderer")
+        BX_ASSERT(max_layer_count >= 1, "Invalid _maxLayerCount %d.", max_layer_count)
+
+        max_layer_count_ = bx::min<uint32_t>(max_layer_count, caps->limits.maxTextureLayers);
+        // the array grows by copying the mirror to a bigger texture, without it all the layers are created at once
+        layer_capacity_ = cpu_mirror ? bx::min<uint32_t>(INITIAL_ARRAY_LAYER_COUNT, max_layer_count_) : max_layer_count_;
+    } else {
+        max_layer_count_ = 6;
+        layer_capacity_ = 6;
+    }
+
+    layers_ = new PackedLayer[max_layer_count_]; // the packer of a layer is initialized when the layer is first used
+
     regions_ = new AtlasRegion[max_regions_count];
-    texture_buffer_ = new uint8_t[texture_size * texture_size * 6 * 4]; // 6 layers * 4 channels (RGBA)
-    bx::memSet(texture_buffer_, 0, texture_size * texture_size * 6 * 4);
+    region_states_ = new RegionState[max_regions_count];
+    if (cpu_mirror) {
+        texture_buffer_ = new uint8_t[GetTextureBufferSize()]; // layers * 4 channels (RGBA) or the encoded blocks
+        bx::memSet(texture_buffer_, 0, GetTextureBufferSize());
+    } else {
+        texture_buffer_ = nullptr;
+    }
 
-    texture_handle_ = bgfx::createTextureCube(texture_size, false, 1, bgfx::TextureFormat::BGRA8);
+    if (texture_type_ == AtlasTextureType::Array) {
+        texture_handle_ = bgfx::createTexture2D(texture_size, texture_size, false, (uint16_t) layer_capacity_, texture_format_);
+    } else {
+        texture_handle_ = bgfx::createTextureCube(texture_size, false, 1, texture_format_);
+    }
 }
 
 Atlas::Atlas(uint16_t texture_size, const uint8_t *texture_buffer, uint16_t region_count, const uint8_t *region_buffer, uint16_t max_regions_count)
-        : used_layers_(6), used_faces_(6), texture_size_(texture_size), region_count_(region_count), max_region_count_(region_count < max_regions_count ? region_count : max_regions_count) {
+        : used_layers_(6), used_faces_(6), layer_capacity_(6), max_layer_count_(6), texture_type_(AtlasTextureType::Cube),
+          packer_type_(RectanglePackerType::Skyline), format_(AtlasFormat::Bgra8), texture_format_(bgfx::TextureFormat::BGRA8),
+          block_size_(1), block_bytes_(4), texture_size_(texture_size),
+          region_count_(region_count), max_region_count_(region_count < max_regions_count ? region_count : max_regions_count) {
     BX_ASSERT(region_count <= 64 && max_regions_count <= 4096, "_regionCount %d, _maxRegionsCount %d", region_count, max_regions_count)
 
     texel_size_ = float(UINT16_MAX) / float(texture_size_);
 
     regions_ = new AtlasRegion[region_count];
+    region_states_ = new RegionState[region_count]{}; // the outlines of serialized regions are unknown, they can't be compacted
     texture_buffer_ = new uint8_t[GetTextureBufferSize()];
 
     bx::memCopy(regions_, region_buffer, region_count * sizeof(AtlasRegion));
@@ -56,6 +167,7 @@ Atlas::~Atlas() {
 
     delete[] layers_;
     delete[] regions_;
+    delete[] region_states_;
     delete[] texture_buffer_;
 }
 
@@ -68,7 +180,7 @@ uint16_t Atlas::AddRegion(uint16_t width, uint16_t height, const uint8_t *bitmap
     uint16_t yy = 0;
     uint32_t idx = 0;
     while (idx < used_layers_) {
-        if (layers_[idx].packer.AddRectangle(width + 1, height + 1, xx, yy)) {
+        if (PackRectangle(layers_[idx].packer, width, height, xx, yy)) {
             break;
         }
 
@@ -76,21 +188,29 @@ uint16_t Atlas::AddRegion(uint16_t width, uint16_t height, const uint8_t *bitmap
     }
 
     if (idx >= used_layers_) {
-        if ((idx + type) > 24 || used_faces_ >= 6) {
+        if (used_faces_ >= max_layer_count_) {
+            return UINT16_MAX;
+        }
+
+        if (used_faces_ >= layer_capacity_ && !GrowTextureArray()) {
             return UINT16_MAX;
         }
 
+        layers_[idx].packer = RectanglePacker::Create(packer_type_);
+        layers_[idx].packer->Init(texture_size_ / block_size_, texture_size_ / block_size_);
+
         AtlasRegion &region = layers_[idx].face_region;
         region.x = 0;
         region.y = 0;
         region.width = texture_size_;
         region.height = texture_size_;
-        region.SetMask(type, used_faces_, 0);
+        // bc4 has nothing but the red channel
+        region.SetMask(type, used_faces_, format_ == AtlasFormat::Bc4 ? 2 : 0);
 
         used_layers_++;
         used_faces_++;
 
-        if (!layers_[idx].packer.AddRectangle(width + 1, height + 1, xx, yy)) {
+        if (!PackRectangle(layers_[idx].packer, width, height, xx, yy)) {
             return UINT16_MAX;
         }
     }
@@ -101,6 +221,7 @@ uint16_t Atlas::AddRegion(uint16_t width, uint16_t height, const uint8_t *bitmap
     region.width = width;
     region.height = height;
     region.mask = layers_[idx].face_region.mask;
+    region_states_[region_count_] = {outline, false};
 
     UpdateRegion(region, bitmap_buffer, type);
 
@@ -112,44 +233,287 @@ uint16_t Atlas::AddRegion(uint16_t width, uint16_t height, const uint8_t *bitmap
     return region_count_++;
 }
 
-void Atlas::UpdateRegion(const AtlasRegion &region, const uint8_t *bitmap_buffer, AtlasRegion::Type type) {
-    uint32_t size = region.width * region.height * 4;
-    if (0 < size) {
-        const bgfx::Memory *mem = bgfx::alloc(size);
-        bx::memSet(mem->data, 0, mem->size); // set to 0 to avoid uninitialized data
-        if (type == AtlasRegion::TypeBgra8) {
-            const uint8_t *in_line_buffer = bitmap_buffer;
-            uint8_t *out_line_buffer = texture_buffer_ + region.GetFaceIndex() * (texture_size_ * texture_size_ * 4) + (((region.y * texture_size_) + region.x) * 4);
-
-            // copy the region to the texture buffer
-            for (int yy = 0; yy < region.height; ++yy) {
-                bx::memCopy(out_line_buffer, in_line_buffer, region.width * 4);
-                in_line_buffer += region.width * 4;
-                out_line_buffer += texture_size_ * 4;
+bool Atlas::PackRectangle(RectanglePacker *packer, uint16_t width, uint16_t height, uint16_t &x, uint16_t &y) const {
+    // the packers work in blocks, which are single texels for Bgra8
+    if (!packer->AddRectangle((width + block_size_) / block_size_, (height + block_size_) / block_size_, x, y)) {
+        return false;
+    }
+
+    x *= block_size_;
+    y *= block_size_;
+    return true;
+}
+
+void Atlas::RemoveRegion(uint16_t region_handle) {
+    BX_ASSERT(region_handle < region_count_, "Invalid region handle %d", region_handle)
+    region_states_[region_handle].is_removed = true;
+}
+
+std::vector<uint16_t> Atlas::Compact() {
+    BX_ASSERT(batch_depth_ == 0, "The atlas can't be compacted during a batch")
+    // the pixels are moved within the mirror, a static atlas has no packers to repack with
+    if (layers_ == nullptr || texture_buffer_ == nullptr) {
+        return {};
+    }
+
+    // the remaining regions keep their relative order
+    std::vector<uint16_t> remap(region_count_, UINT16_MAX);
+    std::vector<uint16_t> live_regions;
+    for (uint16_t ii = 0; ii < region_count_; ++ii) {
+        if (!region_states_[ii].is_removed) {
+            remap[ii] = (uint16_t) live_regions.size();
+            live_regions.push_back(ii);
+        }
+    }
+
+    // tallest first, which packs denser than the insertion order
+    std::vector<uint16_t> packing_order = live_regions;
+    std::stable_sort(packing_order.begin(), packing_order.end(), [this](uint16_t a, uint16_t b) {
+        const uint32_t height_a = regions_[a].height + region_states_[a].outline * 2;
+        const uint32_t height_b = regions_[b].height + region_states_[b].outline * 2;
+        if (height_a != height_b) {
+            return height_a > height_b;
+        }
+        return regions_[a].width + region_states_[a].outline * 2 > regions_[b].width + region_states_[b].outline * 2;
+    });
+
+    // place every region before touching the atlas, it stays untouched if they don't fit anymore
+    auto *layers = new PackedLayer[max_layer_count_];
+    std::vector<AtlasRegion> regions(live_regions.size());
+    uint32_t used_layers = 0;
+    for (uint16_t old_index: packing_order) {
+        const AtlasRegion &old_region = regions_[old_index];
+        const uint16_t outline = region_states_[old_index].outline;
+        const uint16_t width = old_region.width + outline * 2;
+        const uint16_t height = old_region.height + outline * 2;
+
+        uint16_t xx = 0;
+        uint16_t yy = 0;
+        uint32_t idx = 0;
+        while (idx < used_layers && !PackRectangle(layers[idx].packer, width, height, xx, yy)) {
+            idx++;
+        }
+
+        if (idx >= used_layers) {
+            if (used_layers >= layer_capacity_) {
+                delete[] layers;
+                return {};
             }
 
-            bx::memCopy(mem->data, bitmap_buffer, mem->size);
-        } else {
-            uint32_t layer = region.GetComponentIndex();
-            const uint8_t *in_line_buffer = bitmap_buffer;
-            uint8_t *out_line_buffer = texture_buffer_ + region.GetFaceIndex() * (texture_size_ * texture_size_ * 4) + (((region.y * texture_size_) + region.x) * 4);
-
-            // only copies to a single channel of the output buffer and leaves
-            // the other ones zero (effectively using only the first/blue channel in BGRA8 format)
-            for (int yy = 0; yy < region.height; ++yy) {
-                for (int xx = 0; xx < region.width; ++xx) {
-                    out_line_buffer[(xx * 4) + layer] = in_line_buffer[xx];
-                }
+            layers[idx].packer = RectanglePacker::Create(packer_type_);
+            layers[idx].packer->Init(texture_size_ / block_size_, texture_size_ / block_size_);
+            AtlasRegion &face_region = layers[idx].face_region;
+            face_region.x = 0;
+            face_region.y = 0;
+            face_region.width = texture_size_;
+            face_region.height = texture_size_;
+            face_region.SetMask(old_region.GetType(), idx, format_ == AtlasFormat::Bc4 ? 2 : 0);
+            used_layers++;
+
+            if (!PackRectangle(layers[idx].packer, width, height, xx, yy)) {
+                delete[] layers;
+                return {};
+            }
+        }
+
+        AtlasRegion &region = regions[remap[old_index]];
+        region.x = xx + outline;
+        region.y = yy + outline;
+        region.width = old_region.width;
+        region.height = old_region.height;
+        region.SetMask(old_region.GetType(), idx, old_region.GetComponentIndex());
+    }
+
+    // move the pixels (or the blocks of a compressed atlas), outline included, to a fresh mirror
+    const uint32_t face_size = GetFaceBufferSize();
+    const uint32_t pitch = GetRowPitch();
+    auto *texture_buffer = new uint8_t[GetTextureBufferSize()];
+    bx::memSet(texture_buffer, 0, GetTextureBufferSize());
+    for (uint16_t old_index: live_regions) {
+        const AtlasRegion &old_region = regions_[old_index];
+        const AtlasRegion &region = regions[remap[old_index]];
+        const uint16_t outline = region_states_[old_index].outline;
+        const uint32_t row_size = ((old_region.width + outline * 2 + block_size_ - 1) / block_size_) * block_bytes_;
+        const uint32_t row_count = (old_region.height + outline * 2 + block_size_ - 1) / block_size_;
+
+        const uint8_t *in_line_buffer = texture_buffer_ + old_region.GetFaceIndex() * face_size
+                                        + ((old_region.y - outline) / block_size_) * pitch
+                                        + ((old_region.x - outline) / block_size_) * block_bytes_;
+        uint8_t *out_line_buffer = texture_buffer + region.GetFaceIndex() * face_size
+                                   + ((region.y - outline) / block_size_) * pitch
+                                   + ((region.x - outline) / block_size_) * block_bytes_;
+        for (uint32_t yy = 0; yy < row_count; ++yy) {
+            bx::memCopy(out_line_buffer, in_line_buffer, row_size);
+            in_line_buffer += pitch;
+            out_line_buffer += pitch;
+        }
+    }
+    delete[] texture_buffer_;
+    texture_buffer_ = texture_buffer;
+
+    for (uint16_t ii = 0; ii < (uint16_t) live_regions.size(); ++ii) {
+        regions_[ii] = regions[ii];
+        region_states_[ii] = {region_states_[live_regions[ii]].outline, false};
+    }
+    region_count_ = (uint16_t) live_regions.size();
+
+    // the faces emptied by the compaction are uploaded too, so no stale texel is left around the regions
+    const uint32_t uploaded_faces = bx::max(used_faces_, used_layers);
+    delete[] layers_;
+    layers_ = layers;
+    used_layers_ = used_layers;
+    used_faces_ = used_layers;
 
-                bx::memCopy(mem->data + yy * region.width * 4, out_line_buffer, region.width * 4);
-                in_line_buffer += region.width;
-                out_line_buffer += texture_size_ * 4;
+    for (uint32_t ii = 0; ii < uploaded_faces; ++ii) {
+        UploadRectangle(ii, 0, 0, texture_size_, texture_size_);
+    }
+
+    return remap;
+}
+
+void Atlas::UpdateRegion(const AtlasRegion &region, const uint8_t *bitmap_buffer, AtlasRegion::Type type) {
+    if (region.width == 0 || region.height == 0) {
+        return;
+    }
+
+    BX_ASSERT(region.x % block_size_ == 0 && region.y % block_size_ == 0, "A region of a compressed atlas has to start on a block")
+
+    const uint32_t face_index = region.GetFaceIndex();
+    // whole blocks are written, the texels past the region are its padding in the packer
+    const auto width = (uint16_t) ((region.width + block_size_ - 1) / block_size_ * block_size_);
+    const auto height = (uint16_t) ((region.height + block_size_ - 1) / block_size_ * block_size_);
+    const bgfx::Memory *mem = nullptr;
+    const uint8_t *in_line_buffer = bitmap_buffer;
+    uint8_t *out_line_buffer;
+    uint32_t out_pitch;
+
+    if (texture_buffer_ != nullptr) {
+        out_line_buffer = texture_buffer_ + face_index * GetFaceBufferSize() + (region.y / block_size_) * GetRowPitch()
+                          + (region.x / block_size_) * block_bytes_;
+        out_pitch = GetRowPitch();
+    } else {
+        // without a mirror the region is converted in a staging copy, a gray region gets whole texels with
+        // the other channels zeroed, which is what the mirror holds around it anyway since regions never overlap
+        out_pitch = (width / block_size_) * block_bytes_;
+        mem = bgfx::alloc(out_pitch * (height / block_size_));
+        bx::memSet(mem->data, 0, mem->size);
+        out_line_buffer = mem->data;
+    }
+
+    if (format_ != AtlasFormat::Bgra8) {
+        EncodeBlocks(format_, region.width, region.height, bitmap_buffer, type, out_line_buffer, out_pitch);
+    } else if (type == AtlasRegion::TypeBgra8) {
+        // copy the region to the texture buffer
+        for (int yy = 0; yy < region.height; ++yy) {
+            bx::memCopy(out_line_buffer, in_line_buffer, region.width * 4);
+            in_line_buffer += region.width * 4;
+            out_line_buffer += out_pitch;
+        }
+    } else {
+        uint32_t layer = region.GetComponentIndex();
+
+        // only copies to a single channel of the output buffer and leaves
+        // the other ones zero (effectively using only the first/blue channel in BGRA8 format)
+        for (int yy = 0; yy < region.height; ++yy) {
+            for (int xx = 0; xx < region.width; ++xx) {
+                out_line_buffer[(xx * 4) + layer] = in_line_buffer[xx];
             }
+
+            in_line_buffer += region.width;
+            out_line_buffer += out_pitch;
         }
-        bgfx::updateTextureCube(texture_handle_, 0, (uint8_t) region.GetFaceIndex(), 0, region.x, region.y, region.width, region.height, mem);
+    }
+
+    if (mem != nullptr) {
+        UpdateTexture(face_index, region.x, region.y, width, height, mem);
+        return;
+    }
+
+    if (batch_depth_ == 0) {
+        UploadRectangle(face_index, region.x, region.y, width, height);
+        return;
+    }
+
+    DirtyRectangle &dirty = dirty_rectangles_[face_index];
+    if (dirty.x0 >= dirty.x1) {
+        dirty = {region.x, region.y, (uint16_t) (region.x + width), (uint16_t) (region.y + height)};
+    } else {
+        dirty.x0 = bx::min(dirty.x0, region.x);
+        dirty.y0 = bx::min(dirty.y0, region.y);
+        dirty.x1 = bx::max(dirty.x1, (uint16_t) (region.x + width));
+        dirty.y1 = bx::max(dirty.y1, (uint16_t) (region.y + height));
+    }
+}
+
+void Atlas::BeginBatch() {
+    if (batch_depth_++ == 0) {
+        dirty_rectangles_.assign(max_layer_count_, DirtyRectangle{});
     }
 }
 
+void Atlas::EndBatch() {
+    BX_ASSERT(batch_depth_ > 0, "EndBatch called without BeginBatch")
+    if (--batch_depth_ > 0) {
+        return;
+    }
+
+    for (uint32_t ii = 0; ii < (uint32_t) dirty_rectangles_.size(); ++ii) {
+        const DirtyRectangle &dirty = dirty_rectangles_[ii];
+        if (dirty.x0 < dirty.x1) {
+            UploadRectangle(ii, dirty.x0, dirty.y0, dirty.x1 - dirty.x0, dirty.y1 - dirty.y0);
+        }
+    }
+}
+
+void Atlas::UploadRectangle(uint32_t face_index, uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+    const uint32_t row_size = (width / block_size_) * block_bytes_;
+    const uint32_t row_count = height / block_size_;
+    const bgfx::Memory *mem = bgfx::alloc(row_size * row_count);
+    const uint8_t *in_line_buffer = texture_buffer_ + face_index * GetFaceBufferSize() + (y / block_size_) * GetRowPitch()
+                                    + (x / block_size_) * block_bytes_;
+    for (uint32_t yy = 0; yy < row_count; ++yy) {
+        bx::memCopy(mem->data + yy * row_size, in_line_buffer, row_size);
+        in_line_buffer += GetRowPitch();
+    }
+
+    UpdateTexture(face_index, x, y, width, height, mem);
+}
+
+void Atlas::UpdateTexture(uint32_t face_index, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const bgfx::Memory *mem) {
+    if (texture_type_ == AtlasTextureType::Array) {
+        bgfx::updateTexture2D(texture_handle_, (uint16_t) face_index, 0, x, y, width, height, mem);
+    } else {
+        bgfx::updateTextureCube(texture_handle_, 0, (uint8_t) face_index, 0, x, y, width, height, mem);
+    }
+}
+
+bool Atlas::GrowTextureArray() {
+    if (texture_type_ != AtlasTextureType::Array || layer_capacity_ >= max_layer_count_) {
+        return false;
+    }
+    BX_ASSERT(texture_buffer_ != nullptr, "A texture array without a mirror is created with all its layers")
+
+    const uint32_t old_size = GetTextureBufferSize();
+    layer_capacity_ = bx::min(layer_capacity_ * 2, max_layer_count_);
+
+    auto *texture_buffer = new uint8_t[GetTextureBufferSize()];
+    bx::memCopy(texture_buffer, texture_buffer_, old_size);
+    bx::memSet(texture_buffer + old_size, 0, GetTextureBufferSize() - old_size);
+    delete[] texture_buffer_;
+    texture_buffer_ = texture_buffer;
+
+    // a texture can't be resized, create a bigger one with the content of the old one
+    bgfx::destroy(texture_handle_);
+    texture_handle_ = bgfx::createTexture2D(texture_size_, texture_size_, false, (uint16_t) layer_capacity_, texture_format_,
+                                            BGFX_TEXTURE_NONE | BGFX_SAMPLER_NONE, bgfx::copy(texture_buffer_, GetTextureBufferSize()));
+
+    // the new texture already holds everything written during the current batch
+    for (auto &dirty: dirty_rectangles_) {
+        dirty = DirtyRectangle{};
+    }
+    return true;
+}
+
 void Atlas::PackFaceLayerUv(uint32_t idx, uint8_t *vertex_buffer, uint32_t offset, uint32_t stride) const {
     PackUv(layers_[idx].face_region, vertex_buffer, offset, stride);
 }
@@ -167,7 +531,31 @@ static void WriteUv(uint8_t *vertex_buffer, int16_t x, int16_t y, int16_t z, int
     xyzw[3] = w;
 }
 
+void Atlas::PackArrayUv(const AtlasRegion &region, uint8_t *vertex_buffer, uint32_t stride) const {
+    // plain 2D coordinates, no sign juggling needed, the layer is stored as an integer
+    const float uv_scale = float(INT16_MAX) / float(texture_size_);
+    auto x0 = (int16_t) ((float) region.x * uv_scale);
+    auto y0 = (int16_t) ((float) region.y * uv_scale);
+    auto x1 = (int16_t) (((float) region.x + region.width) * uv_scale);
+    auto y1 = (int16_t) (((float) region.y + region.height) * uv_scale);
+    auto layer = (int16_t) region.GetFaceIndex();
+    auto ww = (int16_t) ((float(INT16_MAX) / 4.0f) * (float) region.GetComponentIndex());
+
+    WriteUv(vertex_buffer, x0, y0, layer, ww);
+    vertex_buffer += stride;
+    WriteUv(vertex_buffer, x0, y1, layer, ww);
+    vertex_buffer += stride;
+    WriteUv(vertex_buffer, x1, y1, layer, ww);
+    vertex_buffer += stride;
+    WriteUv(vertex_buffer, x1, y0, layer, ww);
+}
+
 void Atlas::PackUv(const AtlasRegion &region, uint8_t *vertex_buffer, uint32_t offset, uint32_t stride) const {
+    if (texture_type_ == AtlasTextureType::Array) {
+        PackArrayUv(region, vertex_buffer + offset, stride);
+        return;
+    }
+
     auto x0 = (int16_t) (((float) region.x * texel_size_) - float(INT16_MAX));
     auto y0 = (int16_t) (((float) region.y * texel_size_) - float(INT16_MAX));
     auto x1 = (int16_t) ((((float) region.x + region.width) * texel_size_) - float(INT16_MAX));
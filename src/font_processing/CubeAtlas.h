@@ -15,7 +15,34 @@
 /// http://clb.demon.fi/files/RectangleBinPack/
 
 #include <bgfx/bgfx.h>
+#include <vector>
+
 #include "AtlasRegion.h"
+#include "RectanglePacker.h"
+
+/// texture the regions of an atlas are stored in
+struct AtlasTextureType {
+    enum Enum {
+        /// texture cube, limited to its 6 faces
+        Cube,
+        /// 2D texture array, layers are added on demand up to a maximum layer count
+        Array,
+    };
+};
+
+/// format of the atlas texture, the compressed formats are encoded on the cpu when a region is written
+struct AtlasFormat {
+    enum Enum {
+        /// uncompressed, gray regions take a single channel each
+        Bgra8,
+        /// 4 bits per texel, gray regions are stored in all three color channels, the alpha is dropped
+        Bc1,
+        /// 4 bits per texel, a single (red) channel, only suits gray regions (bitmap and sdf fonts)
+        Bc4,
+        /// 8 bits per texel, gray regions are stored in all three color channels
+        Bc7,
+    };
+};
 
 // Atlas represents a texture atlas, which uses the RectanglePacker
 // to efficiently manage the placement of regions in the atlas.
@@ -24,7 +51,19 @@ public:
     /// create an empty dynamic atlas (region can be updated and added)
     /// @param textureSize an atlas creates a texture cube of 6 faces with size equal to (textureSize*textureSize * sizeof(RGBA) )
     /// @param maxRegionCount maximum number of region allowed in the atlas
-    explicit Atlas(uint16_t texture_size, uint16_t max_regions_count = 4096);
+    /// @param textureType with AtlasTextureType::Array the faces are layers of a 2D texture array, the texture is
+    ///   recreated with twice as many layers when it is full, requires BGFX_CAPS_TEXTURE_2D_ARRAY
+    /// @param maxLayerCount maximum number of layers of a texture array, a cube always has 6 faces
+    /// @param packerType algorithm placing the regions in a face, MaxRects fills the faces better than Skyline
+    /// @param cpuMirror keep a copy of the texture in memory (layers * textureSize * textureSize * 4 bytes). Without it
+    ///   the regions are uploaded straight away, but the atlas can't be serialized or compacted, batches upload
+    ///   every region on its own and a texture array is created with all of its maxLayerCount layers up front
+    /// @param format a compressed format places the regions on 4x4 block boundaries and uploads encoded blocks,
+    ///   the mirror holds the encoded blocks too. The texture size has to be a multiple of 4
+    explicit Atlas(uint16_t texture_size, uint16_t max_regions_count = 4096,
+                   AtlasTextureType::Enum texture_type = AtlasTextureType::Cube, uint16_t max_layer_count = 64,
+                   RectanglePackerType::Enum packer_type = RectanglePackerType::Skyline, bool cpu_mirror = true,
+                   AtlasFormat::Enum format = AtlasFormat::Bgra8);
 
     /// initialize a static atlas with serialized data	(region can be updated but not added)
     /// @param textureSize an atlas creates a texture cube of 6 faces with size equal to (textureSize*textureSize * sizeof(RGBA) )
@@ -40,15 +79,37 @@ public:
     uint16_t AddRegion(uint16_t width, uint16_t height, const uint8_t *bitmap_buffer,
                        AtlasRegion::Type type = AtlasRegion::TypeBgra8, uint16_t outline = 0);
 
+    /// mark a region as unused, its space is reclaimed by the next Compact
+    /// @remark the handle stays valid (and the pixels in place) until then
+    void RemoveRegion(uint16_t region_handle);
+
+    /// Repack all the regions that were not removed into fresh packers, move their pixels within the mirrored
+    /// buffer and upload every used face again with a single texture update. The remaining regions get new,
+    /// contiguous handles.
+    /// @return a table mapping every old region handle to its new handle (UINT16_MAX for the removed regions),
+    ///   empty if the atlas was left untouched because it is static, has no cpu mirror or the regions don't fit anymore
+    /// @remark the uv coordinates already packed to vertex buffers have to be packed again with the new handles
+    std::vector<uint16_t> Compact();
+
     /// update a pre allocated region
+    /// @remark in a compressed atlas the whole blocks covering the region are encoded again, the region has to
+    ///   start on a block boundary (as the regions returned by AddRegion without an outline do)
     void UpdateRegion(const AtlasRegion &region, const uint8_t *bitmap_buffer, AtlasRegion::Type type);
 
+    /// Defer the texture uploads of the regions added or updated until EndBatch, only the mirrored
+    /// buffer is written meanwhile. Batches can be nested, the upload happens at the outermost EndBatch.
+    void BeginBatch();
+
+    /// Upload everything written since BeginBatch with a single texture update per modified face.
+    void EndBatch();
+
     /// Pack the UV coordinates of the four corners of a region to a vertex buffer using the supplied vertex format.
     /// v0 -- v3
     /// |     |     encoded in that order:  v0,v1,v2,v3
     /// v1 -- v2
     /// @remark the UV are four signed short normalized components.
     /// @remark the x,y,z components encode cube uv coordinates. The w component encode the color channel if any.
+    /// @remark for a texture array x,y are 2D uv coordinates in [0, 1] and z is the layer index (the raw short value).
     /// @param handle handle to the region we are interested in
     /// @param vertexBuffer address of the first vertex we want to update. Must be valid up to vertexBuffer + offset + 3*stride + 4*sizeof(int16_t), which means the buffer must contains at least 4 vertex includind the first.
     /// @param offset byte offset to the first uv coordinate of the vertex in the buffer
@@ -59,11 +120,25 @@ public:
     /// Same as PackUv but pack a whole face of the atlas cube, mostly used for debugging and visualizing atlas
     void PackFaceLayerUv(uint32_t idx, uint8_t *vertex_buffer, uint32_t offset, uint32_t stride) const;
 
-    /// return the TextureHandle (cube) of the atlas
+    /// return the TextureHandle (cube or 2D array) of the atlas
+    /// @remark the handle of a texture array changes when the array grows
     [[nodiscard]] bgfx::TextureHandle GetTextureHandle() const {
         return texture_handle_;
     }
 
+    [[nodiscard]] AtlasTextureType::Enum GetTextureType() const {
+        return texture_type_;
+    }
+
+    [[nodiscard]] AtlasFormat::Enum GetFormat() const {
+        return format_;
+    }
+
+    /// retrieve the number of faces (or array layers) holding regions
+    [[nodiscard]] uint32_t GetUsedFaceCount() const {
+        return used_faces_;
+    }
+
     //retrieve a region info
     [[nodiscard]] const AtlasRegion &GetRegion(uint16_t handle) const {
         return regions_[handle];
@@ -89,27 +164,69 @@ public:
 
     /// retrieve the byte size of the texture
     [[nodiscard]] uint32_t GetTextureBufferSize() const {
-        return 6 * texture_size_ * texture_size_ * 4;
+        return layer_capacity_ * GetFaceBufferSize();
     }
 
     /// retrieve the mirrored texture buffer (to serialize it)
+    /// @remark nullptr if the atlas was created without a cpu mirror
     [[nodiscard]] const uint8_t *GetTextureBuffer() const {
         return texture_buffer_;
     }
 
 private:
+    /// bytes of a row of blocks (a row of texels for Bgra8) in the mirrored buffer
+    [[nodiscard]] uint32_t GetRowPitch() const {
+        return (texture_size_ / block_size_) * block_bytes_;
+    }
+
+    [[nodiscard]] uint32_t GetFaceBufferSize() const {
+        return GetRowPitch() * (texture_size_ / block_size_);
+    }
+
+    /// place a region of width x height texels (plus the padding between regions) on whole blocks
+    bool PackRectangle(RectanglePacker *packer, uint16_t width, uint16_t height, uint16_t &x, uint16_t &y) const;
+    /// recreate the texture array with more layers, the content is uploaded again from the mirrored buffer
+    bool GrowTextureArray();
+    void PackArrayUv(const AtlasRegion &region, uint8_t *vertex_buffer, uint32_t stride) const;
+    /// copy a rectangle of a face from the mirrored buffer to the texture, the rectangle is block aligned
+    void UploadRectangle(uint32_t face_index, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+    void UpdateTexture(uint32_t face_index, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const bgfx::Memory *mem);
+
     struct PackedLayer;
     PackedLayer *layers_{};
     AtlasRegion *regions_;
+    // bookkeeping of a region needed to move it, regions_ stays tightly packed for serialization
+    struct RegionState {
+        uint16_t outline;
+        bool is_removed;
+    };
+    RegionState *region_states_;
     uint8_t *texture_buffer_;
 
     uint32_t used_layers_;
     uint32_t used_faces_;
+    // faces the texture currently has, always 6 for a cube
+    uint32_t layer_capacity_;
+    uint32_t max_layer_count_;
 
     bgfx::TextureHandle texture_handle_{};
+    AtlasTextureType::Enum texture_type_;
+    RectanglePackerType::Enum packer_type_;
+    AtlasFormat::Enum format_;
+    bgfx::TextureFormat::Enum texture_format_;
+    // texels per side of a block and its size in bytes, Bgra8 is handled as 1x1 blocks of 4 bytes
+    uint16_t block_size_;
+    uint32_t block_bytes_;
     uint16_t texture_size_;
     float texel_size_;
 
     uint16_t region_count_;
     uint16_t max_region_count_;
+
+    // bounds of the texels written to each face during a batch, empty when x0 >= x1
+    struct DirtyRectangle {
+        uint16_t x0, y0, x1, y1;
+    };
+    std::vector<DirtyRectangle> dirty_rectangles_;
+    uint32_t batch_depth_ = 0;
 };
@@ -54,3 +54,8 @@ struct FontInfo {
         }
     }
 };
+
+/// Size of a laid out text in pixels.
+struct TextRectangle {
+    float width, height;
+};
@@ -0,0 +1,179 @@
+﻿#include <stb_truetype.h>
+
+#include "KerningTable.h"
+
+namespace {
+    uint16_t ReadU16(const uint8_t *data) {
+        return (uint16_t) (data[0] << 8 | data[1]);
+    }
+
+    int16_t ReadS16(const uint8_t *data) {
+        return (int16_t) ReadU16(data);
+    }
+
+    // call the function for every glyph in the coverage table together with its coverage index
+    template<typename Function>
+    void ForEachCoveredGlyph(const uint8_t *coverage, Function function) {
+        const uint16_t format = ReadU16(coverage);
+        if (format == 1) {
+            const uint16_t glyph_count = ReadU16(coverage + 2);
+            for (uint16_t i = 0; i < glyph_count; i++) {
+                function(ReadU16(coverage + 4 + 2 * i), i);
+            }
+        } else if (format == 2) {
+            const uint16_t range_count = ReadU16(coverage + 2);
+            for (uint16_t i = 0; i < range_count; i++) {
+                const uint8_t *range = coverage + 4 + 6 * i;
+                const uint16_t start = ReadU16(range);
+                const uint16_t end = ReadU16(range + 2);
+                const uint16_t start_index = ReadU16(range + 4);
+                for (uint32_t glyph = start; glyph <= end; glyph++) {
+                    function((uint16_t) glyph, (uint16_t) (start_index + glyph - start));
+                }
+            }
+        }
+    }
+
+    // fill the class of every glyph, glyphs not listed in the table stay in class 0
+    bool ReadClassDefinition(const uint8_t *class_def, std::vector<uint16_t> &out_classes) {
+        const uint16_t format = ReadU16(class_def);
+        if (format == 1) {
+            const uint16_t start = ReadU16(class_def + 2);
+            const uint16_t glyph_count = ReadU16(class_def + 4);
+            for (uint16_t i = 0; i < glyph_count; i++) {
+                if (start + i < out_classes.size()) out_classes[start + i] = ReadU16(class_def + 6 + 2 * i);
+            }
+            return true;
+        }
+        if (format == 2) {
+            const uint16_t range_count = ReadU16(class_def + 2);
+            for (uint16_t i = 0; i < range_count; i++) {
+                const uint8_t *range = class_def + 4 + 6 * i;
+                const uint16_t value = ReadU16(range + 4);
+                for (uint32_t glyph = ReadU16(range); glyph <= ReadU16(range + 2) && glyph < out_classes.size(); glyph++) {
+                    out_classes[glyph] = value;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+}
+
+void KerningTable::Init(const stbtt_fontinfo &font) {
+    pairs_.clear();
+    class_subtables_.clear();
+    first_glyph_rows_.clear();
+
+    // same precedence as stbtt_GetGlyphKernAdvance, the kern table is ignored if the font has GPOS
+    if (font.gpos) {
+        ExtractGpos(font);
+    } else if (font.kern) {
+        ExtractKern(font);
+    }
+}
+
+int32_t KerningTable::GetKerning(int32_t first_glyph, int32_t second_glyph) const {
+    if (!pairs_.empty()) {
+        auto it = pairs_.find(PairKey(first_glyph, second_glyph));
+        if (it != pairs_.end()) {
+            return it->second;
+        }
+    }
+
+    if (first_glyph < 0 || first_glyph >= (int32_t) first_glyph_rows_.size()) return 0;
+    const ClassRow &row = first_glyph_rows_[first_glyph];
+    if (row.subtable == NO_CLASS_SUBTABLE) return 0;
+
+    const ClassSubtable &subtable = class_subtables_[row.subtable];
+    const uint16_t second_class = second_glyph >= 0 && second_glyph < (int32_t) subtable.second_classes.size() ? subtable.second_classes[second_glyph] : 0;
+    if (second_class >= subtable.second_class_count) return 0;
+
+    return ReadS16(subtable.class_matrix + 2 * (row.first_class * subtable.second_class_count + second_class));
+}
+
+void KerningTable::ExtractGpos(const stbtt_fontinfo &font) {
+    const uint8_t *data = font.data + font.gpos;
+    if (ReadU16(data) != 1 || ReadU16(data + 2) != 0) return;
+
+    const auto glyph_count = (size_t) font.numGlyphs;
+    // a first glyph is resolved by the first subtable that handles it, later subtables can only
+    // add pairs for glyphs that were not resolved yet
+    std::vector<bool> resolved(glyph_count, false);
+
+    const uint8_t *lookup_list = data + ReadU16(data + 8);
+    const uint16_t lookup_count = ReadU16(lookup_list);
+    for (uint16_t i = 0; i < lookup_count; i++) {
+        const uint8_t *lookup = lookup_list + ReadU16(lookup_list + 2 + 2 * i);
+        // only pair adjustment lookups affect the kerning
+        if (ReadU16(lookup) != 2) continue;
+
+        const uint16_t subtable_count = ReadU16(lookup + 4);
+        for (uint16_t j = 0; j < subtable_count; j++) {
+            const uint8_t *subtable = lookup + ReadU16(lookup + 6 + 2 * j);
+            const uint16_t pos_format = ReadU16(subtable);
+            const uint8_t *coverage = subtable + ReadU16(subtable + 2);
+
+            // only the x advance of the first glyph is supported, other value formats give no kerning
+            const bool supported = ReadU16(subtable + 4) == 4 && ReadU16(subtable + 6) == 0;
+            if (!supported) {
+                ForEachCoveredGlyph(coverage, [&](uint16_t glyph, uint16_t) {
+                    if (glyph < glyph_count) resolved[glyph] = true;
+                });
+                continue;
+            }
+
+            if (pos_format == 1) {
+                const uint16_t pair_set_count = ReadU16(subtable + 8);
+                ForEachCoveredGlyph(coverage, [&](uint16_t glyph, uint16_t coverage_index) {
+                    if (glyph >= glyph_count || resolved[glyph] || coverage_index >= pair_set_count) return;
+
+                    const uint8_t *pair_set = subtable + ReadU16(subtable + 10 + 2 * coverage_index);
+                    const uint16_t pair_count = ReadU16(pair_set);
+                    for (uint16_t k = 0; k < pair_count; k++) {
+                        const uint8_t *pair = pair_set + 2 + 4 * k;
+                        const int16_t advance = ReadS16(pair + 2);
+                        // emplace keeps the value of the first subtable that defines the pair
+                        pairs_.emplace(PairKey(glyph, ReadU16(pair)), advance);
+                    }
+                });
+            } else if (pos_format == 2) {
+                ClassSubtable class_subtable;
+                class_subtable.second_classes.assign(glyph_count, 0);
+                std::vector<uint16_t> first_classes(glyph_count, 0);
+                if (!ReadClassDefinition(subtable + ReadU16(subtable + 8), first_classes)) continue;
+                if (!ReadClassDefinition(subtable + ReadU16(subtable + 10), class_subtable.second_classes)) continue;
+
+                const uint16_t first_class_count = ReadU16(subtable + 12);
+                class_subtable.second_class_count = ReadU16(subtable + 14);
+                class_subtable.class_matrix = subtable + 16;
+
+                const auto subtable_index = (uint16_t) class_subtables_.size();
+                bool used = false;
+                ForEachCoveredGlyph(coverage, [&](uint16_t glyph, uint16_t) {
+                    if (glyph >= glyph_count || resolved[glyph] || first_classes[glyph] >= first_class_count) return;
+                    resolved[glyph] = true;
+
+                    if (first_glyph_rows_.empty()) first_glyph_rows_.assign(glyph_count, {NO_CLASS_SUBTABLE, 0});
+                    first_glyph_rows_[glyph] = {subtable_index, first_classes[glyph]};
+                    used = true;
+                });
+
+                if (used) class_subtables_.push_back(std::move(class_subtable));
+            }
+        }
+    }
+}
+
+void KerningTable::ExtractKern(const stbtt_fontinfo &font) {
+    const int length = stbtt_GetKerningTableLength(&font);
+    if (length <= 0) return;
+
+    std::vector<stbtt_kerningentry> entries((size_t) length);
+    stbtt_GetKerningTable(&font, entries.data(), length);
+
+    pairs_.reserve(entries.size());
+    for (const auto &entry: entries) {
+        pairs_.emplace(PairKey(entry.glyph1, entry.glyph2), (int16_t) entry.advance);
+    }
+}
@@ -0,0 +1,56 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+struct stbtt_fontinfo;
+
+// KerningTable holds all the kerning pairs of a font, extracted once from either the GPOS
+// pair adjustment lookups or the legacy kern table (the same precedence as stb_truetype).
+// Explicit glyph pairs are stored in a hash map, class based GPOS subtables are kept as
+// a two level table: first glyph -> class row, second glyph -> class column.
+// All the values are in font units and indexed by glyph index.
+class KerningTable {
+public:
+    /// extract the kerning pairs of an initialized font
+    /// @remark the font data must stay valid for the lifetime of the table
+    void Init(const stbtt_fontinfo &font);
+
+    /// return the horizontal kerning between two glyphs in font units
+    [[nodiscard]] int32_t GetKerning(int32_t first_glyph, int32_t second_glyph) const;
+
+    /// return true if the font has any kerning information
+    [[nodiscard]] bool IsEmpty() const {
+        return pairs_.empty() && class_subtables_.empty();
+    }
+
+private:
+    struct ClassSubtable {
+        // class of every glyph of the font, used to index the column of the matrix
+        std::vector<uint16_t> second_classes;
+        const uint8_t *class_matrix;
+        uint16_t second_class_count;
+    };
+
+    struct ClassRow {
+        uint16_t subtable;
+        uint16_t first_class;
+    };
+
+    static const uint16_t NO_CLASS_SUBTABLE = UINT16_MAX;
+
+    void ExtractGpos(const stbtt_fontinfo &font);
+    void ExtractKern(const stbtt_fontinfo &font);
+
+    static uint32_t PairKey(int32_t first_glyph, int32_t second_glyph) {
+        return ((uint32_t) first_glyph << 16) | ((uint32_t) second_glyph & 0xFFFF);
+    }
+
+    std::unordered_map<uint32_t, int16_t> pairs_;
+
+    std::vector<ClassSubtable> class_subtables_;
+    // class row of every first glyph, the subtable is NO_CLASS_SUBTABLE if the glyph doesn't use one
+    std::vector<ClassRow> first_glyph_rows_;
+};
@@ -0,0 +1,137 @@
+﻿#include <bx/bx.h>
+#include <climits>
+
+#include "MaxRectsPacker.h"
+
+MaxRectsPacker::MaxRectsPacker(uint32_t width, uint32_t height) {
+    Init(width, height);
+}
+
+void MaxRectsPacker::Init(uint32_t width, uint32_t height) {
+    BX_ASSERT(width > 2, "_width must be > 2")
+    BX_ASSERT(height > 2, "_height must be > 2")
+
+    width_ = width;
+    height_ = height;
+    Clear();
+}
+
+void MaxRectsPacker::Clear() {
+    used_space_ = 0;
+    free_rectangles_.clear();
+    new_free_rectangles_.clear();
+
+    // one pixel border around the whole atlas, same as the skyline packer
+    free_rectangles_.push_back({1, 1, (int32_t) width_ - 2, (int32_t) height_ - 2});
+}
+
+bool MaxRectsPacker::AddRectangle(uint16_t width, uint16_t height, uint16_t &out_x, uint16_t &out_y) {
+    out_x = 0;
+    out_y = 0;
+
+    int32_t best_short_side = INT_MAX;
+    int32_t best_long_side = INT_MAX;
+    Rectangle best{};
+
+    for (const Rectangle &free: free_rectangles_) {
+        if (free.width < width || free.height < height) {
+            continue;
+        }
+
+        const int32_t leftover_x = free.width - width;
+        const int32_t leftover_y = free.height - height;
+        const int32_t short_side = bx::min(leftover_x, leftover_y);
+        const int32_t long_side = bx::max(leftover_x, leftover_y);
+
+        if (short_side < best_short_side || (short_side == best_short_side && long_side < best_long_side)) {
+            best = {free.x, free.y, width, height};
+            best_short_side = short_side;
+            best_long_side = long_side;
+        }
+    }
+
+    if (best_short_side == INT_MAX) {
+        return false;
+    }
+
+    // every free rectangle intersecting the placed one is replaced by its remaining parts
+    for (size_t ii = 0; ii < free_rectangles_.size();) {
+        if (SplitFreeRectangle(free_rectangles_[ii], best)) {
+            free_rectangles_[ii] = free_rectangles_.back();
+            free_rectangles_.pop_back();
+        } else {
+            ++ii;
+        }
+    }
+    PruneFreeRectangles();
+
+    out_x = (uint16_t) best.x;
+    out_y = (uint16_t) best.y;
+    used_space_ += width * height;
+    return true;
+}
+
+bool MaxRectsPacker::SplitFreeRectangle(const Rectangle &free, const Rectangle &used) {
+    if (used.x >= free.x + free.width || used.x + used.width <= free.x
+        || used.y >= free.y + free.height || used.y + used.height <= free.y) {
+        return false;
+    }
+
+    if (used.x < free.x + free.width && used.x + used.width > free.x) {
+        // part above the used rectangle
+        if (used.y > free.y && used.y < free.y + free.height) {
+            InsertNewFreeRectangle({free.x, free.y, free.width, used.y - free.y});
+        }
+        // part below the used rectangle
+        if (used.y + used.height < free.y + free.height) {
+            InsertNewFreeRectangle({free.x, used.y + used.height, free.width, free.y + free.height - (used.y + used.height)});
+        }
+    }
+
+    if (used.y < free.y + free.height && used.y + used.height > free.y) {
+        // part left of the used rectangle
+        if (used.x > free.x && used.x < free.x + free.width) {
+            InsertNewFreeRectangle({free.x, free.y, used.x - free.x, free.height});
+        }
+        // part right of the used rectangle
+        if (used.x + used.width < free.x + free.width) {
+            InsertNewFreeRectangle({used.x + used.width, free.y, free.x + free.width - (used.x + used.width), free.height});
+        }
+    }
+
+    return true;
+}
+
+void MaxRectsPacker::InsertNewFreeRectangle(const Rectangle &rectangle) {
+    for (size_t ii = 0; ii < new_free_rectangles_.size();) {
+        if (IsContainedIn(rectangle, new_free_rectangles_[ii])) {
+            return;
+        }
+
+        if (IsContainedIn(new_free_rectangles_[ii], rectangle)) {
+            new_free_rectangles_[ii] = new_free_rectangles_.back();
+            new_free_rectangles_.pop_back();
+        } else {
+            ++ii;
+        }
+    }
+
+    new_free_rectangles_.push_back(rectangle);
+}
+
+void MaxRectsPacker::PruneFreeRectangles() {
+    // the new rectangles are parts of split rectangles, so an old one can't be contained in them
+    for (const Rectangle &free: free_rectangles_) {
+        for (size_t ii = 0; ii < new_free_rectangles_.size();) {
+            if (IsContainedIn(new_free_rectangles_[ii], free)) {
+                new_free_rectangles_[ii] = new_free_rectangles_.back();
+                new_free_rectangles_.pop_back();
+            } else {
+                ++ii;
+            }
+        }
+    }
+
+    free_rectangles_.insert(free_rectangles_.end(), new_free_rectangles_.begin(), new_free_rectangles_.end());
+    new_free_rectangles_.clear();
+}
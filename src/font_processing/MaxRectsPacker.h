@@ -0,0 +1,49 @@
+﻿#pragma once
+
+#include <vector>
+
+#include "RectanglePacker.h"
+
+// MaxRectsPacker keeps the list of all the maximal free rectangles of the layer and places
+// every rectangle in the free rectangle that leaves the shortest side over (best short side fit),
+// based on "A Thousand Ways to Pack the Bin" by Jukka Jylänki.
+// It reuses the holes the skyline can't reach, at the cost of a larger free list.
+class MaxRectsPacker : public RectanglePacker {
+public:
+    MaxRectsPacker() = default;
+    MaxRectsPacker(uint32_t width, uint32_t height);
+
+    void Init(uint32_t width, uint32_t height) override;
+
+    bool AddRectangle(uint16_t width, uint16_t height, uint16_t &out_x, uint16_t &out_y) override;
+
+    void Clear() override;
+
+    /// number of free rectangles currently tracked
+    [[nodiscard]] uint32_t GetFreeRectangleCount() const {
+        return (uint32_t) free_rectangles_.size();
+    }
+
+private:
+    struct Rectangle {
+        int32_t x, y;
+        int32_t width, height;
+    };
+
+    /// split the free rectangle around the used one, @return false if they don't intersect
+    bool SplitFreeRectangle(const Rectangle &free, const Rectangle &used);
+
+    /// add a rectangle created by a split unless it is contained in another new one
+    void InsertNewFreeRectangle(const Rectangle &rectangle);
+
+    /// drop the new free rectangles contained in an old one and merge both lists
+    void PruneFreeRectangles();
+
+    static bool IsContainedIn(const Rectangle &a, const Rectangle &b) {
+        return a.x >= b.x && a.y >= b.y && a.x + a.width <= b.x + b.width && a.y + a.height <= b.y + b.height;
+    }
+
+    std::vector<Rectangle> free_rectangles_;
+    // rectangles created by the last split, only these can be redundant
+    std::vector<Rectangle> new_free_rectangles_;
+};
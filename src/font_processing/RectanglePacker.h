@@ -3,22 +3,36 @@
 //
 #pragma once
 
-#include <bgfx/bgfx.h>
-#include <vector>
-
-#include "../utilities.h"
+#include <cstdint>
+
+/// algorithm used to place the regions of an atlas layer
+struct RectanglePackerType {
+    enum Enum {
+        /// skyline bottom-left, small and fast, loses the space below the skyline steps
+        Skyline,
+        /// maximal rectangles with best short side fit, slower but fills the layer better
+        MaxRects,
+    };
+};
 
+// RectanglePacker is the common interface of the packing algorithms used by the Atlas.
+// All the packers keep a one pixel border around the packed area.
 class RectanglePacker {
 public:
-    RectanglePacker();
-    RectanglePacker(uint32_t width, uint32_t height);
+    virtual ~RectanglePacker() = default;
+
+    /// create an uninitialized packer of the given type
+    static RectanglePacker *Create(RectanglePackerType::Enum type);
 
     /// non constructor initialization
-    void Init(uint32_t width, uint32_t height);
+    virtual void Init(uint32_t width, uint32_t height) = 0;
 
     /// find a suitable position for the given rectangle
     /// @return true if the rectangle can be added, false otherwise
-    bool AddRectangle(uint16_t width, uint16_t height, uint16_t &out_x, uint16_t &out_y);
+    virtual bool AddRectangle(uint16_t width, uint16_t height, uint16_t &out_x, uint16_t &out_y) = 0;
+
+    /// reset to initial state
+    virtual void Clear() = 0;
 
     /// return the used surface in squared unit
     [[nodiscard]] uint32_t GetUsedSurface() const {
@@ -33,27 +47,8 @@ public:
     /// return the usage ratio of the available surface [0:1]
     [[nodiscard]] float GetUsageRatio() const;
 
-    /// reset to initial state
-    void Clear();
-
-private:
-    int32_t Fit(uint32_t skyline_node_index, uint16_t width, uint16_t height);
-
-    /// Merges all skyline nodes that are at the same level.
-    void Merge();
-
-    struct Node {
-        Node(int16_t x, int16_t y, int16_t width) : x(x), y(y), width(width) {
-        }
-
-        int16_t x;     //< The starting x-coordinate (leftmost).
-        int16_t y;     //< The y-coordinate of the skyline level line.
-        int32_t width; //< The line _width. The ending coordinate (inclusive) will be x+width-1.
-    };
-
-
-    uint32_t width_;            //< width (in pixels) of the underlying texture
-    uint32_t height_;           //< height (in pixels) of the underlying texture
-    uint32_t used_space_;        //< Surface used in squared pixel
-    std::vector<Node> skyline_; //< node of the skyline algorithm
+protected:
+    uint32_t width_ = 0;        //< width (in pixels) of the underlying texture
+    uint32_t height_ = 0;       //< height (in pixels) of the underlying texture
+    uint32_t used_space_ = 0;   //< Surface used in squared pixel
 };
@@ -0,0 +1,46 @@
+﻿//
+// Created by MihaelGolob on 30. 04. 2024.
+//
+#pragma once
+
+#include <bgfx/bgfx.h>
+#include <vector>
+
+#include "../utilities.h"
+#include "RectanglePacker.h"
+
+// SkylinePacker implements the Skyline Bottom-Left algorithm, it only keeps the top
+// edge of the packed rectangles, so the memory and the insert cost stay small but the
+// space below a skyline step is lost.
+class SkylinePacker : public RectanglePacker {
+public:
+    SkylinePacker();
+    SkylinePacker(uint32_t width, uint32_t height);
+
+    /// non constructor initialization
+    void Init(uint32_t width, uint32_t height) override;
+
+    /// find a suitable position for the given rectangle
+    /// @return true if the rectangle can be added, false otherwise
+    bool AddRectangle(uint16_t width, uint16_t height, uint16_t &out_x, uint16_t &out_y) override;
+
+    /// reset to initial state
+    void Clear() override;
+
+private:
+    int32_t Fit(uint32_t skyline_node_index, uint16_t width, uint16_t height);
+
+    /// Merges all skyline nodes that are at the same level.
+    void Merge();
+
+    struct Node {
+        Node(int16_t x, int16_t y, int16_t width) : x(x), y(y), width(width) {
+        }
+
+        int16_t x;     //< The starting x-coordinate (leftmost).
+        int16_t y;     //< The y-coordinate of the skyline level line.
+        int32_t width; //< The line _width. The ending coordinate (inclusive) will be x+width-1.
+    };
+
+    std::vector<Node> skyline_; //< node of the skyline algorithm
+};
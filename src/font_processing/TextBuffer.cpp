@@ -7,62 +7,72 @@
 #include "utf8.h"
 #include "FontInfo.h"
 #include "../managers/FontManager.h"
+#include "../managers/GlyphSnapshot.h"
 
 #include <bgfx/embedded_shader.h>
 
 #define MAX_BUFFERED_CHARACTERS (8192 - 5)
+#define UTF8_DECODE_CHUNK_SIZE 256
 
 TextBuffer::TextBuffer(FontManager *font_manager)
-        : text_color_(UINT32_MAX), background_color_(UINT32_MAX),
+        : style_flags_(STYLE_NORMAL), text_color_(UINT32_MAX), background_color_(UINT32_MAX), outline_color_(UINT32_MAX),
           pen_x_(0), pen_y_(0), origin_x_(0), origin_y_(0), line_ascender_(0), line_descender_(0), line_gap_(0),
           previous_code_point_(0), font_manager_(font_manager),
-          vertex_buffer_(new TextVertex[MAX_BUFFERED_CHARACTERS * 4]),
-          index_buffer_(new uint16_t[MAX_BUFFERED_CHARACTERS * 6]),
-          style_buffer_(new uint8_t[MAX_BUFFERED_CHARACTERS * 4]), index_count_(0), line_start_index_(0),
+          own_vertex_buffer_(new TextVertex[MAX_BUFFERED_CHARACTERS * 4]),
+          own_index_buffer_(new uint16_t[MAX_BUFFERED_CHARACTERS * 6]),
+          style_buffer_(new uint8_t[MAX_BUFFERED_CHARACTERS * 4]),
+          quad_region_buffer_(new uint16_t[MAX_BUFFERED_CHARACTERS]), index_count_(0), line_start_index_(0),
           vertex_count_(0) {
+    vertex_buffer_ = own_vertex_buffer_;
+    index_buffer_ = own_index_buffer_;
+    max_quad_count_ = MAX_BUFFERED_CHARACTERS;
     rectangle_.width = 0;
     rectangle_.height = 0;
 }
 
 TextBuffer::~TextBuffer() {
-    delete[] vertex_buffer_;
-    delete[] index_buffer_;
+    delete[] own_vertex_buffer_;
+    delete[] own_index_buffer_;
     delete[] style_buffer_;
+    delete[] quad_region_buffer_;
 }
 
 void TextBuffer::AppendText(FontHandle font_handle, const char *string, const char *end) {
-    if (vertex_count_ == 0) {
+    if (vertex_count_ == 0 && flushed_vertex_count_ == 0) {
         origin_x_ = pen_x_;
         origin_y_ = pen_y_;
         line_descender_ = 0;
         line_ascender_ = 0;
+        line_resolved_ascender_ = 0;
         line_gap_ = 0;
         previous_code_point_ = 0;
     }
 
-    CodePoint codepoint = 0;
-    uint32_t state = 0;
-
-    if (end == nullptr) {
-        end = string + bx::strLen(string);
-    }
-    BX_ASSERT(end >= string, "")
-
-    for (; *string && string < end; ++string) {
-        if (Utf8Decode(&state, (uint32_t *) &codepoint, *string) == UTF8_ACCEPT) {
-            AppendGlyph(font_handle, codepoint);
+    uint32_t code_point = 0;
+    uint32_t state = UTF8_ACCEPT;
+    BX_ASSERT(end == nullptr || end >= string, "")
+
+    // decode the string in chunks, the decoder stops at the null character so the length is not needed up front
+    uint32_t code_points[UTF8_DECODE_CHUNK_SIZE];
+    uint32_t count;
+    do {
+        count = Utf8DecodeBatch(&state, &code_point, &string, end, code_points, UTF8_DECODE_CHUNK_SIZE);
+        for (uint32_t ii = 0; ii < count; ++ii) {
+            AppendGlyph(font_handle, (CodePoint) code_points[ii]);
         }
-    }
+    } while (count == UTF8_DECODE_CHUNK_SIZE);
 
     BX_ASSERT(state == UTF8_ACCEPT, "The string is not well-formed")
+    ResolveLineAlignment();
 }
 
 void TextBuffer::AppendText(FontHandle font_handle, const wchar_t *string, const wchar_t *end) {
-    if (vertex_count_ == 0) {
+    if (vertex_count_ == 0 && flushed_vertex_count_ == 0) {
         origin_x_ = pen_x_;
         origin_y_ = pen_y_;
         line_descender_ = 0;
         line_ascender_ = 0;
+        line_resolved_ascender_ = 0;
         line_gap_ = 0;
         previous_code_point_ = 0;
     }
@@ -76,10 +86,44 @@ void TextBuffer::AppendText(FontHandle font_handle, const wchar_t *string, const
         uint32_t code_point = *current;
         AppendGlyph(font_handle, code_point);
     }
+    ResolveLineAlignment();
+}
+
+void TextBuffer::AppendText(const GlyphSnapshot &snapshot, FontHandle font_handle, const char *string, const char *end) {
+    snapshot_ = &snapshot;
+    AppendText(font_handle, string, end);
+    snapshot_ = nullptr;
+}
+
+void TextBuffer::SetStorage(uint8_t *vertices, uint16_t *indices, uint32_t max_quad_count) {
+    // the start of the current line stays in the previous storage, keep it for the vertical centering
+    if (vertex_count_ > line_start_index_) {
+        previous_line_segments_.push_back({vertex_buffer_, line_start_index_, vertex_count_});
+    }
+    flushed_vertex_count_ += vertex_count_;
+
+    vertex_buffer_ = (TextVertex *) vertices;
+    index_buffer_ = indices;
+    max_quad_count_ = bx::min(max_quad_count, GetMaxQuadCount());
+    vertex_count_ = 0;
+    index_count_ = 0;
+    line_start_index_ = 0;
+}
+
+void TextBuffer::ResetStorage() {
+    vertex_buffer_ = own_vertex_buffer_;
+    index_buffer_ = own_index_buffer_;
+    max_quad_count_ = MAX_BUFFERED_CHARACTERS;
+    ClearTextBuffer();
+}
+
+uint32_t TextBuffer::GetMaxQuadCount() {
+    // the style buffer is always owned, the vertex indices of a storage must also fit in 16 bits
+    return MAX_BUFFERED_CHARACTERS;
 }
 
 void TextBuffer::AppendAtlasFace(uint16_t face_index) {
-    if (vertex_count_ / 4 >= MAX_BUFFERED_CHARACTERS) {
+    if (!HasRoom(1)) {
         return;
     }
 
@@ -95,14 +139,7 @@ void TextBuffer::AppendAtlasFace(uint16_t face_index) {
     SetVertex(vertex_count_ + 2, x1, y1, background_color_);
     SetVertex(vertex_count_ + 3, x1, y0, background_color_);
 
-    index_buffer_[index_count_ + 0] = vertex_count_ + 0;
-    index_buffer_[index_count_ + 1] = vertex_count_ + 1;
-    index_buffer_[index_count_ + 2] = vertex_count_ + 2;
-    index_buffer_[index_count_ + 3] = vertex_count_ + 0;
-    index_buffer_[index_count_ + 4] = vertex_count_ + 2;
-    index_buffer_[index_count_ + 5] = vertex_count_ + 3;
-    vertex_count_ += 4;
-    index_count_ += 6;
+    AppendQuadIndices(UINT16_MAX);
 }
 
 void TextBuffer::ClearTextBuffer() {
@@ -115,11 +152,41 @@ void TextBuffer::ClearTextBuffer() {
     index_count_ = 0;
     line_start_index_ = 0;
     line_ascender_ = 0;
+    line_resolved_ascender_ = 0;
     line_descender_ = 0;
     line_gap_ = 0;
     previous_code_point_ = 0;
     rectangle_.width = 0;
     rectangle_.height = 0;
+    previous_line_segments_.clear();
+    flushed_vertex_count_ = 0;
+}
+
+void TextBuffer::RemapAtlasRegions(const std::vector<uint16_t> &remap) {
+    BX_ASSERT(vertex_buffer_ == own_vertex_buffer_, "The vertices are not in the storage owned by the buffer")
+    const Atlas *atlas = font_manager_->GetAtlas();
+
+    for (uint32_t ii = 0; ii < vertex_count_; ii += 4) {
+        uint16_t &region_index = quad_region_buffer_[ii / 4];
+        // whole atlas faces keep their place
+        if (region_index == UINT16_MAX) {
+            continue;
+        }
+
+        region_index = remap[region_index];
+        if (region_index == UINT16_MAX) {
+            for (uint32_t jj = 1; jj < 4; ++jj) {
+                vertex_buffer_[ii + jj].x = vertex_buffer_[ii].x;
+                vertex_buffer_[ii + jj].y = vertex_buffer_[ii].y;
+            }
+            continue;
+        }
+
+        // same uv slot as AppendGlyph, backgrounds always use the first one
+        const bool is_bgra8 = style_buffer_[ii] != STYLE_BACKGROUND && atlas->GetRegion(region_index).GetType() == AtlasRegion::TypeBgra8;
+        const uint32_t uv_offset = is_bgra8 ? offsetof(TextVertex, u1) : offsetof(TextVertex, u);
+        atlas->PackUv(region_index, (uint8_t *) vertex_buffer_, sizeof(TextVertex) * ii + uv_offset, sizeof(TextVertex));
+    }
 }
 
 void TextBuffer::AppendGlyph(FontHandle handle, CodePoint code_point) {
@@ -130,83 +197,141 @@ void TextBuffer::AppendGlyph(FontHandle handle, CodePoint code_point) {
         return;
     }
 
-    const GlyphInfo *glyph = font_manager_->GetGlyphInfo(handle, code_point);
+    const GlyphInfo *glyph = GetGlyphInfo(handle, code_point);
     BX_WARN(nullptr != glyph, "Glyph not found (font handle %d, code point %d)", handle.idx, code_point)
     if (nullptr == glyph) {
         previous_code_point_ = 0;
         return;
     }
 
-    if (vertex_count_ / 4 >= MAX_BUFFERED_CHARACTERS) {
+    const bool draw_background = (style_flags_ & STYLE_BACKGROUND) != 0 && (background_color_ & 0xff000000) != 0;
+    if (!HasRoom(draw_background ? 2 : 1)) {
         previous_code_point_ = 0;
         return;
     }
 
-    const FontInfo &font = font_manager_->GetFontInfo(handle);
+    const FontInfo &font = GetFontInfo(handle);
 
     if (code_point == L'\n') {
+        ResolveLineAlignment();
+        CullLineAboveClipRectangle();
         pen_x_ = origin_x_;
         pen_y_ += line_gap_ + line_ascender_ - line_descender_;
         line_gap_ = font.line_gap;
         line_descender_ = font.descender;
         line_ascender_ = font.ascender;
+        line_resolved_ascender_ = font.ascender;
         line_start_index_ = vertex_count_;
+        previous_line_segments_.clear();
         previous_code_point_ = 0;
         return;
     }
 
     //is there a change of font size that require the text on the left to be centered again ?
+    //the vertices already on the line are moved once, when the line is resolved
     if (font.ascender > line_ascender_ || (font.descender < line_descender_)) {
         if (font.descender < line_descender_) {
             line_descender_ = font.descender;
             line_gap_ = font.line_gap;
         }
 
-        float txt_decals = (font.ascender - line_ascender_);
         line_ascender_ = font.ascender;
         line_gap_ = font.line_gap;
-        VerticalCenterLastLine((txt_decals), (pen_y_ - line_ascender_), (pen_y_ + line_ascender_ - line_descender_ + line_gap_));
     }
 
-    float kerning = font_manager_->GetKerning(handle, previous_code_point_, code_point);
+    // the quads are placed against the current line metrics, but written relative to the ascender the
+    // line was last resolved with, so that resolving the line moves every vertex by the same amount
+    const float line_offset_y = line_resolved_ascender_ - line_ascender_;
+
+    float kerning = GetKerning(handle, previous_code_point_, code_point);
     pen_x_ += kerning;
 
-    const GlyphInfo &black_glyph = font_manager_->GetBlackGlyph();
     const Atlas *atlas = font_manager_->GetAtlas();
-    const AtlasRegion &atlas_region = atlas->GetRegion(glyph->region_index);
 
-    if (atlas_region.GetType() == AtlasRegion::TypeBgra8) {
-        bx::memSet(&vertex_buffer_[vertex_count_], 0, sizeof(TextVertex) * 4);
+    if (draw_background) {
+        float x0 = pen_x_ - kerning;
+        float y0 = pen_y_;
+        float x1 = x0 + glyph->advance_x;
+        float y1 = pen_y_ + line_ascender_ - line_descender_ + line_gap_;
+
+        const GlyphInfo *black_glyph = GetBlackGlyph();
+        if (black_glyph != nullptr && !IsClipped(x0, y0, x1)) {
+            bx::memSet(&vertex_buffer_[vertex_count_], 0, sizeof(TextVertex) * 4);
+            atlas->PackUv(black_glyph->region_index, (uint8_t *) vertex_buffer_, sizeof(TextVertex) * vertex_count_ + offsetof(TextVertex, u), sizeof(TextVertex));
+
+            SetVertex(vertex_count_ + 0, x0, y0 + line_offset_y, background_color_, STYLE_BACKGROUND);
+            SetVertex(vertex_count_ + 1, x0, y1 + line_offset_y, background_color_, STYLE_BACKGROUND);
+            SetVertex(vertex_count_ + 2, x1, y1 + line_offset_y, background_color_, STYLE_BACKGROUND);
+            SetVertex(vertex_count_ + 3, x1, y0 + line_offset_y, background_color_, STYLE_BACKGROUND);
+            AppendQuadIndices(black_glyph->region_index);
+        }
+    }
 
-        atlas->PackUv(glyph->region_index, (uint8_t *) vertex_buffer_, sizeof(TextVertex) * vertex_count_ + offsetof(TextVertex, u1), sizeof(TextVertex));
+    const AtlasRegion &atlas_region = atlas->GetRegion(glyph->region_index);
+    const bool is_bgra8 = atlas_region.GetType() == AtlasRegion::TypeBgra8;
 
+    float x0, y0, x1, y1;
+    if (is_bgra8) {
         float glyph_scale = glyph->bitmap_scale;
         float glyph_width = glyph->width * glyph_scale;
         float glyph_height = glyph->height * glyph_scale;
-        float x0 = pen_x_ + (glyph->offset_x);
-        float y0 = (pen_y_ + (font.ascender + -font.descender - glyph_height) / 2);
-        float x1 = (x0 + glyph_width);
-        float y1 = (y0 + glyph_height);
-
-        SetVertex(vertex_count_ + 0, x0, y0, text_color_);
-        SetVertex(vertex_count_ + 1, x0, y1, text_color_);
-        SetVertex(vertex_count_ + 2, x1, y1, text_color_);
-        SetVertex(vertex_count_ + 3, x1, y0, text_color_);
+        x0 = pen_x_ + (glyph->offset_x);
+        y0 = (pen_y_ + (font.ascender + -font.descender - glyph_height) / 2);
+        x1 = (x0 + glyph_width);
+        y1 = (y0 + glyph_height);
     } else {
+        x0 = pen_x_ + (glyph->offset_x);
+        y0 = (pen_y_ + line_ascender_ + (glyph->offset_y));
+        x1 = (x0 + glyph->width);
+        y1 = (y0 + glyph->height);
+    }
+
+    // glyphs completely outside of the clip rectangle only advance the pen,
+    // the ones crossing its border are cut by the scissor at submit time
+    if (!IsClipped(x0, y0, x1)) {
         bx::memSet(&vertex_buffer_[vertex_count_], 0, sizeof(TextVertex) * 4);
+        const uint32_t uv_offset = is_bgra8 ? offsetof(TextVertex, u1) : offsetof(TextVertex, u);
+        atlas->PackUv(glyph->region_index, (uint8_t *) vertex_buffer_, sizeof(TextVertex) * vertex_count_ + uv_offset, sizeof(TextVertex));
+
+        SetVertex(vertex_count_ + 0, x0, y0 + line_offset_y, text_color_);
+        SetVertex(vertex_count_ + 1, x0, y1 + line_offset_y, text_color_);
+        SetVertex(vertex_count_ + 2, x1, y1 + line_offset_y, text_color_);
+        SetVertex(vertex_count_ + 3, x1, y0 + line_offset_y, text_color_);
+        AppendQuadIndices(glyph->region_index);
+    }
 
-        atlas->PackUv(glyph->region_index, (uint8_t *) vertex_buffer_, sizeof(TextVertex) * vertex_count_ + offsetof(TextVertex, u), sizeof(TextVertex));
-        float x0 = pen_x_ + (glyph->offset_x);
-        float y0 = (pen_y_ + line_ascender_ + (glyph->offset_y));
-        float x1 = (x0 + glyph->width);
-        float y1 = (y0 + glyph->height);
+    pen_x_ += glyph->advance_x;
+    if (pen_x_ > rectangle_.width) {
+        rectangle_.width = pen_x_;
+    }
 
-        SetVertex(vertex_count_ + 0, x0, y0, text_color_);
-        SetVertex(vertex_count_ + 1, x0, y1, text_color_);
-        SetVertex(vertex_count_ + 2, x1, y1, text_color_);
-        SetVertex(vertex_count_ + 3, x1, y0, text_color_);
+    if ((pen_y_ + line_ascender_ - line_descender_ + line_gap_) > rectangle_.height) {
+        rectangle_.height = (pen_y_ + line_ascender_ - line_descender_ + line_gap_);
     }
 
+    previous_code_point_ = code_point;
+}
+
+const GlyphInfo *TextBuffer::GetGlyphInfo(FontHandle handle, CodePoint code_point) {
+    return snapshot_ != nullptr ? snapshot_->GetGlyphInfo(handle, code_point) : font_manager_->GetGlyphInfo(handle, code_point);
+}
+
+const FontInfo &TextBuffer::GetFontInfo(FontHandle handle) const {
+    return snapshot_ != nullptr ? snapshot_->GetFontInfo(handle) : font_manager_->GetFontInfo(handle);
+}
+
+float TextBuffer::GetKerning(FontHandle handle, CodePoint prev_code_point, CodePoint code_point) {
+    return snapshot_ != nullptr ? snapshot_->GetKerning(handle, prev_code_point, code_point) : font_manager_->GetKerning(handle, prev_code_point, code_point);
+}
+
+const GlyphInfo *TextBuffer::GetBlackGlyph() {
+    // a snapshot without the background glyph can't add it to the atlas, the background is skipped
+    return snapshot_ != nullptr ? snapshot_->GetBlackGlyph() : &font_manager_->GetBlackGlyph();
+}
+
+void TextBuffer::AppendQuadIndices(uint16_t region_index) {
+    quad_region_buffer_[vertex_count_ / 4] = region_index;
+
     // first triangle of a quad
     index_buffer_[index_count_ + 0] = vertex_count_ + 0;
     index_buffer_[index_count_ + 1] = vertex_count_ + 1;
@@ -215,27 +340,69 @@ void TextBuffer::AppendGlyph(FontHandle handle, CodePoint code_point) {
     index_buffer_[index_count_ + 3] = vertex_count_ + 0;
     index_buffer_[index_count_ + 4] = vertex_count_ + 2;
     index_buffer_[index_count_ + 5] = vertex_count_ + 3;
-    
+
     vertex_count_ += 4;
     index_count_ += 6;
+}
 
-    pen_x_ += glyph->advance_x;
-    if (pen_x_ > rectangle_.width) {
-        rectangle_.width = pen_x_;
+bool TextBuffer::HasRoom(uint32_t quad_count) {
+    if (vertex_count_ / 4 + quad_count <= max_quad_count_) {
+        return true;
     }
 
-    if ((pen_y_ + line_ascender_ - line_descender_ + line_gap_) > rectangle_.height) {
-        rectangle_.height = (pen_y_ + line_ascender_ - line_descender_ + line_gap_);
+    if (storage_full_callback_) {
+        storage_full_callback_();
     }
+    return vertex_count_ / 4 + quad_count <= max_quad_count_;
+}
 
-    previous_code_point_ = code_point;
+void TextBuffer::ResolveLineAlignment() {
+    if (line_ascender_ != line_resolved_ascender_) {
+        VerticalCenterLastLine(line_ascender_ - line_resolved_ascender_);
+        line_resolved_ascender_ = line_ascender_;
+    }
 }
 
-void TextBuffer::VerticalCenterLastLine(float txt_decal_y, float top, float bottom) {
+void TextBuffer::VerticalCenterLastLine(float txt_decal_y) {
+    for (const LineSegment &segment: previous_line_segments_) {
+        for (uint32_t ii = segment.begin; ii < segment.end; ii += 4) {
+            segment.vertices[ii + 0].y += txt_decal_y;
+            segment.vertices[ii + 1].y += txt_decal_y;
+            segment.vertices[ii + 2].y += txt_decal_y;
+            segment.vertices[ii + 3].y += txt_decal_y;
+        }
+    }
+
     for (uint32_t ii = line_start_index_; ii < vertex_count_; ii += 4) {
         vertex_buffer_[ii + 0].y += txt_decal_y;
         vertex_buffer_[ii + 1].y += txt_decal_y;
         vertex_buffer_[ii + 2].y += txt_decal_y;
         vertex_buffer_[ii + 3].y += txt_decal_y;
     }
+}
+
+void TextBuffer::CullLineAboveClipRectangle() {
+    if (!has_clip_rectangle_) {
+        return;
+    }
+
+    // the indices of a quad only depend on its position in the buffer, so the ones of the kept quads
+    // are already right once the quads are moved down
+    uint32_t kept_vertex_count = line_start_index_;
+    for (uint32_t ii = line_start_index_; ii < vertex_count_; ii += 4) {
+        // the second vertex is the bottom left corner of the quad
+        if (vertex_buffer_[ii + 1].y <= clip_rectangle_.y) {
+            continue;
+        }
+
+        if (kept_vertex_count != ii) {
+            bx::memCopy(&vertex_buffer_[kept_vertex_count], &vertex_buffer_[ii], sizeof(TextVertex) * 4);
+            bx::memCopy(&style_buffer_[kept_vertex_count], &style_buffer_[ii], 4);
+            quad_region_buffer_[kept_vertex_count / 4] = quad_region_buffer_[ii / 4];
+        }
+        kept_vertex_count += 4;
+    }
+
+    vertex_count_ = kept_vertex_count;
+    index_count_ = kept_vertex_count / 4 * 6;
 }
\ No newline at end of file
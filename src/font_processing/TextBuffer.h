@@ -4,10 +4,16 @@
 
 #pragma once
 
+#include <functional>
+#include <vector>
+
 #include "NumberTypes.h"
 #include "FontHandles.h"
+#include "FontInfo.h"
 
 class FontManager;
+class GlyphSnapshot;
+struct GlyphInfo;
 
 typedef int CodePoint;
 
@@ -20,8 +26,18 @@ struct BufferType {
     };
 };
 
-struct TextRectangle {
-    float width, height;
+/// clip rectangle of a text buffer in buffer space
+struct TextClipRectangle {
+    float x, y, width, height;
+};
+
+/// style flags of the appended text
+enum TextStyleFlags {
+    STYLE_NORMAL = 0,
+    /// draw a quad in the background color behind every glyph
+    STYLE_BACKGROUND = 1 << 0,
+    /// draw an outline in the outline color around the glyphs, only for the sdf and msdf font types
+    STYLE_OUTLINE = 1 << 1,
 };
 
 class TextBuffer {
@@ -33,19 +49,84 @@ public:
 
     ~TextBuffer();
 
+    /// Move the pen, the next glyph is not kerned against the previous one.
     void SetPenPosition(float x, float y) {
         pen_x_ = x;
         pen_y_ = y;
+        previous_code_point_ = 0;
+    }
+
+    /// Set the style flags for the text appended after this call (TextStyleFlags).
+    void SetStyle(uint32_t flags = STYLE_NORMAL) {
+        style_flags_ = flags;
+    }
+
+    /// Set the color of the text appended after this call.
+    void SetTextColor(uint32_t rgba = 0x000000FF) {
+        text_color_ = ToAbgr(rgba);
+    }
+
+    /// Set the outline color of the text appended after this call, used with STYLE_OUTLINE.
+    void SetOutlineColor(uint32_t rgba = 0x000000FF) {
+        outline_color_ = ToAbgr(rgba);
+    }
+
+    /// Set the background color of the text appended after this call, used with STYLE_BACKGROUND.
+    void SetBackgroundColor(uint32_t rgba = 0x000000FF) {
+        background_color_ = ToAbgr(rgba);
+    }
+
+    /// Set a clip rectangle in buffer space. Glyphs appended after this call that are completely
+    /// outside of it are skipped, the ones crossing its border are cut with a scissor when submitted.
+    /// @remark the glyphs above it are only dropped at the end of their line, once its alignment is known
+    void SetClipRectangle(float x, float y, float width, float height) {
+        clip_rectangle_ = {x, y, width, height};
+        has_clip_rectangle_ = true;
+    }
+
+    /// Disable the clip rectangle.
+    void ClearClipRectangle() {
+        has_clip_rectangle_ = false;
+    }
+
+    [[nodiscard]] bool HasClipRectangle() const {
+        return has_clip_rectangle_;
+    }
+
+    [[nodiscard]] const TextClipRectangle &GetClipRectangle() const {
+        return clip_rectangle_;
     }
 
     /// Append an ASCII/utf-8 string to the buffer using current pen
-    /// position and color.
+    /// position, color and style.
     void AppendText(FontHandle font_handle, const char *string, const char *end = nullptr);
 
     /// Append a wide char unicode string to the buffer using current pen
     /// position and color.
     void AppendText(FontHandle font_handle, const wchar_t *string, const wchar_t *end = nullptr);
 
+    /// Append an utf-8 string reading the glyphs from a snapshot instead of the font manager.
+    /// The font manager is not modified, so buffers can be filled in parallel from worker threads.
+    /// @remark glyphs missing from the snapshot are skipped
+    void AppendText(const GlyphSnapshot &snapshot, FontHandle font_handle, const char *string, const char *end = nullptr);
+
+    /// Write the following vertices and indices to external memory (e.g. bgfx transient buffers) instead
+    /// of the arrays owned by the buffer. The vertex and index counts restart from 0 in the new storage.
+    /// @remark the vertices must be GetVertexSize() bytes each, max_quad_count is capped to GetMaxQuadCount()
+    void SetStorage(uint8_t *vertices, uint16_t *indices, uint32_t max_quad_count);
+
+    /// Go back to the arrays owned by the buffer and clear it.
+    void ResetStorage();
+
+    /// Called when a glyph doesn't fit in the storage anymore, the callback can continue
+    /// the layout in new memory with SetStorage, otherwise the glyph is dropped.
+    void SetStorageFullCallback(const std::function<void()> &callback) {
+        storage_full_callback_ = callback;
+    }
+
+    /// Maximum number of quads (glyphs and backgrounds) a storage can hold.
+    [[nodiscard]] static uint32_t GetMaxQuadCount();
+
     /// Append a whole face of the atlas cube, mostly used for debugging
     /// and visualizing atlas.
     void AppendAtlasFace(uint16_t face_index);
@@ -53,6 +134,12 @@ public:
     /// Clear the text buffer and reset its state (pen/color)
     void ClearTextBuffer();
 
+    /// Pack the uv coordinates of the glyphs again after the atlas was compacted, the glyphs whose region
+    /// was removed are collapsed.
+    /// @param remap the table returned by Atlas::Compact
+    /// @remark only the vertices in the storage owned by the buffer are updated
+    void RemapAtlasRegions(const std::vector<uint16_t> &remap);
+
     /// Get pointer to the vertex buffer to submit it to the graphic card.
     const uint8_t *GetVertexBuffer() {
         return (uint8_t *) vertex_buffer_;
@@ -94,7 +181,22 @@ public:
 private:
     void AppendGlyph(FontHandle handle, CodePoint code_point);
 
-    void VerticalCenterLastLine(float txt_decal_y, float top, float bottom);
+    /// move the vertices of the current line once to the final ascender of the line,
+    /// called at the end of a line and at the end of every append
+    void ResolveLineAlignment();
+    void VerticalCenterLastLine(float txt_decal_y);
+    /// drop the quads of the current line that are above the clip rectangle once the line is aligned,
+    /// the quads already handed to a previous storage are left to the scissor
+    void CullLineAboveClipRectangle();
+
+    /// make room for quad_count quads, asking for a new storage if the current one is full
+    bool HasRoom(uint32_t quad_count);
+
+    // glyph lookups go through the snapshot while one is set, the font manager otherwise
+    const GlyphInfo *GetGlyphInfo(FontHandle handle, CodePoint code_point);
+    const FontInfo &GetFontInfo(FontHandle handle) const;
+    float GetKerning(FontHandle handle, CodePoint prev_code_point, CodePoint code_point);
+    const GlyphInfo *GetBlackGlyph();
 
     static uint32_t ToAbgr(uint32_t rgba) {
         return (((rgba >> 0) & 0xff) << 24)
@@ -103,10 +205,24 @@ private:
                | (((rgba >> 24) & 0xff) << 0);
     }
 
-    void SetVertex(uint32_t i, float x, float y, uint32_t rgba) {
+    void SetVertex(uint32_t i, float x, float y, uint32_t rgba, uint8_t style = STYLE_NORMAL) {
         vertex_buffer_[i].x = x;
         vertex_buffer_[i].y = y;
         vertex_buffer_[i].rgba = rgba;
+        // without an outline the shaders blend towards a fully transparent copy of the text color
+        vertex_buffer_[i].rgba_outline = (style_flags_ & STYLE_OUTLINE) != 0 ? outline_color_ : rgba & 0x00ffffff;
+        style_buffer_[i] = style;
+    }
+
+    /// @param region_index atlas region the quad samples, UINT16_MAX for a whole atlas face
+    void AppendQuadIndices(uint16_t region_index);
+
+    /// resolving the line alignment can only move a quad down, so a quad above the clip rectangle may still
+    /// end up inside it, those are culled by CullLineAboveClipRectangle at the end of the line
+    [[nodiscard]] bool IsClipped(float x0, float y0, float x1) const {
+        return has_clip_rectangle_
+               && (x1 <= clip_rectangle_.x || x0 >= clip_rectangle_.x + clip_rectangle_.width
+                   || y0 >= clip_rectangle_.y + clip_rectangle_.height);
     }
 
     struct TextVertex {
@@ -118,9 +234,13 @@ private:
         uint32_t rgba_outline;
     };
 
-    // color states
+    // style states
+    uint32_t style_flags_;
+
+    // color states, stored as abgr to match the vertex layout
     uint32_t text_color_;
     uint32_t background_color_;
+    uint32_t outline_color_;
     
     //position states
     float pen_x_;
@@ -130,17 +250,43 @@ private:
     float origin_y_;
 
     float line_ascender_;
+    // ascender the vertices of the current line are currently placed with
+    float line_resolved_ascender_ = 0;
     float line_descender_;
     float line_gap_;
 
     CodePoint previous_code_point_;
 
     TextRectangle rectangle_{};
+
+    TextClipRectangle clip_rectangle_{};
+    bool has_clip_rectangle_ = false;
     FontManager *font_manager_;
+    // set for the duration of a snapshot AppendText
+    const GlyphSnapshot *snapshot_ = nullptr;
+
+    // part of the current line written to a previous storage, still re-centered with the rest of the line
+    struct LineSegment {
+        TextVertex *vertices;
+        uint32_t begin;
+        uint32_t end;
+    };
 
+    // storage currently written to, either the arrays below or external memory
     TextVertex *vertex_buffer_;
     uint16_t *index_buffer_;
+    uint32_t max_quad_count_;
+
+    TextVertex *own_vertex_buffer_;
+    uint16_t *own_index_buffer_;
     uint8_t *style_buffer_;
+    // atlas region of every quad of the owned storage, to pack the uv coordinates again
+    uint16_t *quad_region_buffer_;
+
+    std::function<void()> storage_full_callback_;
+    std::vector<LineSegment> previous_line_segments_;
+    // vertices written to previous storages since the buffer was cleared
+    uint32_t flushed_vertex_count_ = 0;
 
     uint32_t index_count_;
     uint32_t line_start_index_;
@@ -22,15 +22,59 @@ void TrueTypeFont::Init(const uint8_t *buffer, uint32_t buffer_size, int32_t fon
     stbtt_InitFont(&font_, buffer, offset);
 
     scale_ = stbtt_ScaleForMappingEmToPixels(&font_, (float) pixel_height);
+    stbtt_GetFontVMetrics(&font_, &ascent_, &descent_, &line_gap_);
+
+    bmp_glyph_indices_.clear();
+    kerning_table_.Init(font_);
 
     padding_ = padding;
 }
 
+int32_t TrueTypeFont::GetGlyphIndex(CodePoint code_point) {
+    if (code_point < 0 || code_point > 0xFFFF) {
+        return stbtt_FindGlyphIndex(&font_, code_point);
+    }
+
+    if (bmp_glyph_indices_.empty()) {
+        bmp_glyph_indices_.assign(0x10000, UNRESOLVED_GLYPH_INDEX);
+    }
+
+    uint16_t &glyph_index = bmp_glyph_indices_[code_point];
+    if (glyph_index == UNRESOLVED_GLYPH_INDEX) {
+        glyph_index = (uint16_t) stbtt_FindGlyphIndex(&font_, code_point);
+    }
+    return glyph_index;
+}
+
+float TrueTypeFont::GetKerning(CodePoint prev_code_point, CodePoint code_point) {
+    // skip the glyph lookups if the font has no kerning at all
+    if (kerning_table_.IsEmpty()) return 0.0f;
+    return GetGlyphKerning(GetGlyphIndex(prev_code_point), GetGlyphIndex(code_point));
+}
+
+float TrueTypeFont::GetGlyphKerning(int32_t prev_glyph_index, int32_t glyph_index) const {
+    return scale_ * (float) kerning_table_.GetKerning(prev_glyph_index, glyph_index);
+}
+
+void TrueTypeFont::CalculateGlyphMetrics(int32_t glyph_index, GlyphInfo &out_glyph_info, int32_t &x0, int32_t &y0, int32_t &x1, int32_t &y1) const {
+    int32_t advance, lsb;
+    stbtt_GetGlyphHMetrics(&font_, glyph_index, &advance, &lsb);
+
+    const float scale = scale_;
+    stbtt_GetGlyphBitmapBox(&font_, glyph_index, scale, scale, &x0, &y0, &x1, &y1);
+
+    out_glyph_info.offset_x = (float) x0;
+    out_glyph_info.offset_y = (float) y0;
+    out_glyph_info.width = (float) (x1 - x0);
+    out_glyph_info.height = (float) (y1 - y0);
+    out_glyph_info.advance_x = bx::round(((float) advance) * scale);
+    out_glyph_info.advance_y = bx::round(((float) (ascent_ + descent_ + line_gap_)) * scale);
+}
+
 FontInfo TrueTypeFont::GetFontInfo() {
-    int ascent;
-    int descent;
-    int line_gap;
-    stbtt_GetFontVMetrics(&font_, &ascent, &descent, &line_gap);
+    const int ascent = ascent_;
+    const int descent = descent_;
+    const int line_gap = line_gap_;
 
     float scale = scale_;
 
@@ -52,83 +96,42 @@ FontInfo TrueTypeFont::GetFontInfo() {
 GlyphInfo TrueTypeFont::GetGlyphInfo(CodePoint code_point) {
     auto glyph_info = GlyphInfo();
 
-    int32_t ascent, descent, line_gap;
-    stbtt_GetFontVMetrics(&font_, &ascent, &descent, &line_gap);
-
-    int32_t advance, lsb;
-    stbtt_GetCodepointHMetrics(&font_, code_point, &advance, &lsb);
-
-    const float scale = scale_;
     int32_t x0, y0, x1, y1;
-    stbtt_GetCodepointBitmapBox(&font_, code_point, scale, scale, &x0, &y0, &x1, &y1);
-
-    const int32_t glyph_width = x1 - x0;
-    const int32_t glyph_height = y1 - y0;
-
-    glyph_info.offset_x = (float) x0;
-    glyph_info.offset_y = (float) y0;
-    glyph_info.width = (float) glyph_width;
-    glyph_info.height = (float) glyph_height;
-    glyph_info.advance_x = bx::round(((float) advance) * scale);
-    glyph_info.advance_y = bx::round(((float) (ascent + descent + line_gap)) * scale);
+    CalculateGlyphMetrics(GetGlyphIndex(code_point), glyph_info, x0, y0, x1, y1);
     
     return glyph_info;
 }
 
 bool TrueTypeFont::BakeGlyphAlpha(CodePoint code_point, GlyphInfo &glyph_info, uint8_t *out_buffer) {
-    int32_t ascent, descent, line_gap;
-    stbtt_GetFontVMetrics(&font_, &ascent, &descent, &line_gap);
-
-    int32_t advance, lsb;
-    stbtt_GetCodepointHMetrics(&font_, code_point, &advance, &lsb);
+    const int32_t glyph_index = GetGlyphIndex(code_point);
 
-    const float scale = scale_;
     int32_t x0, y0, x1, y1;
-    stbtt_GetCodepointBitmapBox(&font_, code_point, scale, scale, &x0, &y0, &x1, &y1);
+    CalculateGlyphMetrics(glyph_index, glyph_info, x0, y0, x1, y1);
 
     const int32_t ww = x1 - x0;
     const int32_t hh = y1 - y0;
 
-    glyph_info.offset_x = (float) x0;
-    glyph_info.offset_y = (float) y0;
-    glyph_info.width = (float) ww;
-    glyph_info.height = (float) hh;
-    glyph_info.advance_x = bx::round(((float) advance) * scale);
-    glyph_info.advance_y = bx::round(((float) (ascent + descent + line_gap)) * scale);
-
     uint32_t bpp = 1;
     uint32_t dst_pitch = ww * bpp;
 
-    stbtt_MakeCodepointBitmap(&font_, out_buffer, ww, hh, dst_pitch, scale, scale, code_point);
+    stbtt_MakeGlyphBitmap(&font_, out_buffer, ww, hh, dst_pitch, scale_, scale_, glyph_index);
 
     return true;
 }
 
 bool TrueTypeFont::BakeGlyphSdf(CodePoint code_point, GlyphInfo &out_glyph_info, uint8_t *out_buffer) {
-    int32_t ascent, descent, line_gap;
-    stbtt_GetFontVMetrics(&font_, &ascent, &descent, &line_gap);
-
-    int32_t advance, lsb;
-    stbtt_GetCodepointHMetrics(&font_, code_point, &advance, &lsb);
+    const int32_t glyph_index = GetGlyphIndex(code_point);
 
-    const float scale = scale_;
     int32_t x0, y0, x1, y1;
-    stbtt_GetCodepointBitmapBox(&font_, code_point, scale, scale, &x0, &y0, &x1, &y1);
+    CalculateGlyphMetrics(glyph_index, out_glyph_info, x0, y0, x1, y1);
 
     const int32_t glyph_width = x1 - x0;
     const int32_t glyph_height = y1 - y0;
 
-    out_glyph_info.offset_x = (float) x0;
-    out_glyph_info.offset_y = (float) y0;
-    out_glyph_info.width = (float) glyph_width;
-    out_glyph_info.height = (float) glyph_height;
-    out_glyph_info.advance_x = bx::round(((float) advance) * scale);
-    out_glyph_info.advance_y = bx::round(((float) (ascent + descent + line_gap)) * scale);
-
     int bpp = 1;
     int dst_pitch = glyph_width * bpp;
 
-    stbtt_MakeCodepointBitmap(&font_, out_buffer, glyph_width, glyph_height, dst_pitch, scale, scale, code_point);
+    stbtt_MakeGlyphBitmap(&font_, out_buffer, glyph_width, glyph_height, dst_pitch, scale_, scale_, glyph_index);
 
 #ifdef DEBUG_LOG_GLYPH_BUFFER
     std::cout << "Glyph " << (char)_codePoint << " buffer size is (" << glyphWidth << "," << glyphHeight << ")"  << std::endl;
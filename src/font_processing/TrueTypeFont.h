@@ -5,8 +5,10 @@
 #pragma once
 
 #include <stb_truetype.h>
+#include <vector>
 
 #include "FontInfo.h"
+#include "KerningTable.h"
 #include "GlyphInfo.h"
 #include "NumberTypes.h"
 
@@ -28,6 +30,17 @@ public:
     
     GlyphInfo GetGlyphInfo(CodePoint code_point);
 
+    /// return the glyph index of a code point, 0 (missing glyph) if the font doesn't contain it
+    /// @remark lookups in the basic multilingual plane are cached in a dense table
+    int32_t GetGlyphIndex(CodePoint code_point);
+
+    /// return the kerning between two code points in pixels
+    float GetKerning(CodePoint prev_code_point, CodePoint code_point);
+
+    /// return the kerning between two already resolved glyph indices in pixels
+    /// @remark doesn't modify the font, so it can be called from multiple threads
+    [[nodiscard]] float GetGlyphKerning(int32_t prev_glyph_index, int32_t glyph_index) const;
+
     /// raster a glyph as 8bit alpha to a memory buffer
     /// update the GlyphInfo according to the raster strategy
     /// @ remark buffer min size: glyphInfo.m_width * glyphInfo * height * sizeof(char)
@@ -39,8 +52,23 @@ public:
 private:
     friend class FontManager;
 
+    /// fill the metrics of a glyph and return its bitmap box
+    void CalculateGlyphMetrics(int32_t glyph_index, GlyphInfo &out_glyph_info, int32_t &x0, int32_t &y0, int32_t &x1, int32_t &y1) const;
+
     stbtt_fontinfo font_;
     float scale_{};
 
+    // vertical metrics are constant for the whole font, so they are only read once
+    int32_t ascent_{};
+    int32_t descent_{};
+    int32_t line_gap_{};
+
+    // glyph indices of the basic multilingual plane, allocated on first lookup
+    static constexpr uint16_t UNRESOLVED_GLYPH_INDEX = UINT16_MAX;
+    std::vector<uint16_t> bmp_glyph_indices_;
+
+    // kerning pairs extracted once, shared with all the fonts scaled from this one
+    KerningTable kerning_table_;
+
     int16_t padding_;
 };
\ No newline at end of file
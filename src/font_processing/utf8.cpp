@@ -21,6 +21,16 @@
 
 #include "utf8.h"
 
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define UTF8_SIMD_SSE2 1
+#	include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#	define UTF8_SIMD_NEON 1
+#	include <arm_neon.h>
+#endif
+
 static const uint8_t s_utf8d[364] =
 {
 	// The first part of the table maps bytes to character classes that
@@ -55,3 +65,114 @@ uint32_t Utf8Decode(uint32_t* state, uint32_t* codep, uint8_t ch)
 	*state = s_utf8d[256 + *state + type];
 	return *state;
 }
+
+// Return the number of leading bytes of a 16 byte block that are ASCII and not null.
+// If all 16 bytes qualify they are also widened to code points.
+static uint32_t DecodeAsciiBlock(const uint8_t* block, bool aligned, uint32_t* out_code_points)
+{
+#if UTF8_SIMD_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i bytes = aligned
+		? _mm_load_si128( (const __m128i*)block)
+		: _mm_loadu_si128( (const __m128i*)block)
+		;
+
+	// high bit set or null character
+	const uint32_t mask = (uint32_t)(_mm_movemask_epi8(bytes) | _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, zero) ) );
+	if (mask != 0)
+	{
+		uint32_t length = 0;
+		while (0 == (mask & (1u << length) ) )
+		{
+			++length;
+		}
+		return length;
+	}
+
+	const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+	const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+	_mm_storeu_si128( (__m128i*)(out_code_points +  0), _mm_unpacklo_epi16(lo, zero) );
+	_mm_storeu_si128( (__m128i*)(out_code_points +  4), _mm_unpackhi_epi16(lo, zero) );
+	_mm_storeu_si128( (__m128i*)(out_code_points +  8), _mm_unpacklo_epi16(hi, zero) );
+	_mm_storeu_si128( (__m128i*)(out_code_points + 12), _mm_unpackhi_epi16(hi, zero) );
+	return 16;
+#elif UTF8_SIMD_NEON
+	(void)aligned;
+	const uint8x16_t bytes = vld1q_u8(block);
+	const uint8x16_t invalid = vorrq_u8(vcgeq_u8(bytes, vdupq_n_u8(0x80) ), vceqq_u8(bytes, vdupq_n_u8(0) ) );
+	if (0 != vmaxvq_u8(invalid) )
+	{
+		uint32_t length = 0;
+		while (block[length] != 0 && block[length] < 0x80)
+		{
+			++length;
+		}
+		return length;
+	}
+
+	const uint16x8_t lo = vmovl_u8(vget_low_u8(bytes) );
+	const uint16x8_t hi = vmovl_u8(vget_high_u8(bytes) );
+	vst1q_u32(out_code_points +  0, vmovl_u16(vget_low_u16(lo) ) );
+	vst1q_u32(out_code_points +  4, vmovl_u16(vget_high_u16(lo) ) );
+	vst1q_u32(out_code_points +  8, vmovl_u16(vget_low_u16(hi) ) );
+	vst1q_u32(out_code_points + 12, vmovl_u16(vget_high_u16(hi) ) );
+	return 16;
+#else
+	(void)aligned;
+	uint32_t length = 0;
+	while (length < 16 && block[length] != 0 && block[length] < 0x80)
+	{
+		out_code_points[length] = block[length];
+		++length;
+	}
+	return length;
+#endif
+}
+
+uint32_t Utf8DecodeBatch(uint32_t* state, uint32_t* codep, const char** string, const char* end, uint32_t* out_code_points, uint32_t max_count)
+{
+	const uint8_t* current = (const uint8_t*)*string;
+	uint32_t count = 0;
+
+	while (count < max_count)
+	{
+		// without a known end only aligned blocks are read, so the read never crosses into the next page
+		const bool block_available = NULL != end
+			? (const char*)current + 16 <= end
+			: 0 == ( (uintptr_t)current & 15)
+			;
+
+		if (*state == UTF8_ACCEPT
+		&&  max_count - count >= 16
+		&&  block_available)
+		{
+			const uint32_t length = DecodeAsciiBlock(current, NULL == end, out_code_points + count);
+			if (length == 16)
+			{
+				count   += 16;
+				current += 16;
+				continue;
+			}
+
+			for (uint32_t ii = 0; ii < length; ++ii)
+			{
+				out_code_points[count++] = current[ii];
+			}
+			current += length;
+		}
+
+		if ( (NULL != end && (const char*)current >= end)
+		||  0 == *current)
+		{
+			break;
+		}
+
+		if (Utf8Decode(state, codep, *current++) == UTF8_ACCEPT)
+		{
+			out_code_points[count++] = *codep;
+		}
+	}
+
+	*string = (const char*)current;
+	return count;
+}
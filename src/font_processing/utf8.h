@@ -8,3 +8,13 @@
 #define UTF8_REJECT 1
 
 uint32_t Utf8Decode(uint32_t* state, uint32_t* codep, uint8_t ch);
+
+/// Decode an utf-8 string into an array of code points. ASCII runs are checked and widened
+/// 16 bytes at a time, only multibyte sequences go through the DFA.
+/// Decoding stops at the end of the string, at a null character or when the output array is full.
+/// @param state decoder state, UTF8_ACCEPT for the first call, keeps partial sequences between calls
+/// @param codep code point being decoded, keeps partial sequences between calls
+/// @param string the string to decode, advanced past the decoded bytes
+/// @param end end of the string or nullptr if the string is null terminated
+/// @return number of code points written, less than max_count only if the whole string was decoded
+uint32_t Utf8DecodeBatch(uint32_t* state, uint32_t* codep, const char** string, const char* end, uint32_t* out_code_points, uint32_t max_count);
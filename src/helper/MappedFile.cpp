@@ -0,0 +1,108 @@
+﻿#include <bx/platform.h>
+
+#if BX_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.h"
+#include "../utilities.h"
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+bool MappedFile::Open(const char *path) {
+    Close();
+
+    if (Map(path)) {
+        is_mapped_ = true;
+        return true;
+    }
+
+    // fall back to reading the whole file
+    data_ = (const uint8_t *) Load(path, &size_);
+    is_mapped_ = false;
+    return data_ != nullptr;
+}
+
+void MappedFile::Close() {
+    if (data_ == nullptr) return;
+
+    if (is_mapped_) {
+        Unmap();
+    } else {
+        bx::free(GetDefaultAllocator(), (void *) data_);
+    }
+
+    data_ = nullptr;
+    size_ = 0;
+    is_mapped_ = false;
+}
+
+#if BX_PLATFORM_WINDOWS
+bool MappedFile::Map(const char *path) {
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0 || file_size.QuadPart > UINT32_MAX) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    file_handle_ = file;
+    mapping_handle_ = mapping;
+    data_ = (const uint8_t *) view;
+    size_ = (uint32_t) file_size.QuadPart;
+    return true;
+}
+
+void MappedFile::Unmap() {
+    UnmapViewOfFile(data_);
+    CloseHandle(mapping_handle_);
+    CloseHandle(file_handle_);
+    mapping_handle_ = nullptr;
+    file_handle_ = nullptr;
+}
+#else
+bool MappedFile::Map(const char *path) {
+    int file = open(path, O_RDONLY);
+    if (file < 0) return false;
+
+    struct stat file_stat{};
+    if (fstat(file, &file_stat) != 0 || file_stat.st_size == 0 || (uint64_t) file_stat.st_size > UINT32_MAX) {
+        close(file);
+        return false;
+    }
+
+    void *view = mmap(nullptr, (size_t) file_stat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file); // the mapping stays valid after the descriptor is closed
+    if (view == MAP_FAILED) return false;
+
+    data_ = (const uint8_t *) view;
+    size_ = (uint32_t) file_stat.st_size;
+    return true;
+}
+
+void MappedFile::Unmap() {
+    munmap((void *) data_, size_);
+}
+#endif
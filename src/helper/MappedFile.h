@@ -0,0 +1,45 @@
+﻿#pragma once
+
+#include <cstdint>
+
+// MappedFile maps a whole file into memory as read-only. If the mapping fails
+// (or isn't supported by the platform) the file is read into a heap buffer instead.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// map the file at the given path, previously mapped file is closed
+    /// @return true if the file could be opened
+    bool Open(const char *path);
+
+    /// unmap the file and release its memory
+    void Close();
+
+    [[nodiscard]] const uint8_t *GetData() const {
+        return data_;
+    }
+
+    [[nodiscard]] uint32_t GetSize() const {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsOpen() const {
+        return data_ != nullptr;
+    }
+
+private:
+    bool Map(const char *path);
+    void Unmap();
+
+    const uint8_t *data_ = nullptr;
+    uint32_t size_ = 0;
+    bool is_mapped_ = false; // false if data_ is a heap copy of the file
+
+    // native handles of the mapping (only used on windows)
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+};
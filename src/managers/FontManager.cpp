@@ -11,11 +11,18 @@
 #include <bx/bx.h>
 #include <bx/math.h>
 #include <cwchar> 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <unordered_set>
 #include "FontManager.h"
+#include "../font_processing/utf8.h"
 #include "../font_processing/CubeAtlas.h"
 #include "../utilities.h"
 
 #define MAX_FONT_BUFFER_SIZE (512 * 512 * 4)
+// below this many glyphs per thread PreloadGlyphs doesn't start another thread
+#define MIN_GLYPHS_PER_BAKE_THREAD 32
 
 FontManager::FontManager(Atlas *atlas) : own_atlas_(false), atlas_(atlas) {
     Init();
@@ -28,10 +35,9 @@ FontManager::FontManager(uint16_t texture_side_width) : own_atlas_(true), atlas_
 void FontManager::Init() {
     cached_files_ = new CachedFile[MAX_OPENED_FILES];
     cached_fonts_ = new CachedFont[MAX_OPENED_FONT];
-    cached_faces_ = new FT_Face[MAX_OPENED_FONT];
+    cached_faces_ = new CachedFace[MAX_OPENED_FACES];
     cached_msdf_generators_ = new MsdfGenerator[MAX_OPENED_MSDF_GEN];
     buffer_ = new uint8_t[MAX_FONT_BUFFER_SIZE];
-    msdf_original_generator_ = new MsdfOriginalGenerator();
     
     if (FT_Init_FreeType(&ft_library_)) {
         BX_ASSERT(false, "Failed to initialize freetype library")
@@ -48,8 +54,6 @@ FontManager::~FontManager() {
     delete[] cached_faces_;
     delete[] buffer_;
     delete[] cached_msdf_generators_;
-    
-    delete msdf_original_generator_;
 
     if (own_atlas_) {
         delete atlas_;
@@ -57,16 +61,17 @@ FontManager::~FontManager() {
 }
 
 TrueTypeHandle FontManager::CreateTtf(const char* file_path) {
-    // Load the file
-    uint32_t size;
-    void* data = Load(file_path, &size);
-    
     uint16_t id = files_handles_.alloc();
     BX_ASSERT(id != bx::kInvalidHandle, "Invalid handle used")
-    cached_files_[id].buffer = new uint8_t[size];
-    cached_files_[id].buffer_size = size;
-    cached_files_[id].path = file_path;
-    bx::memCopy(cached_files_[id].buffer, data, size);
+    
+    // map the file, it is shared by stb_truetype, freetype and msdfgen
+    if (!cached_files_[id].file.Open(file_path)) {
+        files_handles_.free(id);
+        return TrueTypeHandle{bx::kInvalidHandle};
+    }
+    cached_files_[id].face_handle.idx = bx::kInvalidHandle;
+    cached_files_[id].file_id = next_file_id_++;
+    cached_files_[id].ref_count = 1;
 
     TrueTypeHandle ret = {id};
     return ret;
@@ -74,10 +79,16 @@ TrueTypeHandle FontManager::CreateTtf(const char* file_path) {
 
 void FontManager::DestroyTtf(TrueTypeHandle handle) {
     BX_ASSERT(isValid(handle), "Invalid handle used")
-    delete[] cached_files_[handle.idx].buffer;
-    cached_files_[handle.idx].buffer_size = 0;
-    cached_files_[handle.idx].buffer = nullptr;
-    cached_files_[handle.idx].path = nullptr;
+    ReleaseTtf(handle);
+}
+
+void FontManager::ReleaseTtf(TrueTypeHandle handle) {
+    CachedFile &font_file = cached_files_[handle.idx];
+    if (--font_file.ref_count > 0) {
+        return;
+    }
+
+    font_file.file.Close();
     files_handles_.free(handle.idx);
 }
 
@@ -85,7 +96,8 @@ FontHandle FontManager::CreateFontByPixelSize(TrueTypeHandle ttf_handle, uint32_
     BX_ASSERT(isValid(ttf_handle), "Invalid handle used")
 
     auto ttf = new TrueTypeFont();
-    ttf->Init(cached_files_[ttf_handle.idx].buffer, cached_files_[ttf_handle.idx].buffer_size, typeface_index, pixel_size, glyph_padding);
+    const MappedFile &font_file = cached_files_[ttf_handle.idx].file;
+    ttf->Init(font_file.GetData(), font_file.GetSize(), typeface_index, pixel_size, glyph_padding);
 
     uint16_t font_idx = font_handles_.alloc();
     BX_ASSERT(font_idx != bx::kInvalidHandle, "Invalid handle used")
@@ -95,12 +107,20 @@ FontHandle FontManager::CreateFontByPixelSize(TrueTypeHandle ttf_handle, uint32_
     font.font_info = ttf->GetFontInfo();
     font.font_info.font_type = font_type;
     font.font_info.pixel_size = uint16_t(pixel_size);
-    font.cached_glyphs.clear();
+    font.glyph_key = {cached_files_[ttf_handle.idx].file_id, (int32_t) typeface_index, 0, pixel_size, (int16_t) glyph_padding, font_type};
+    font.progressive = false;
+    font.glyph_generation = 0;
+    ClearCachedGlyphs(font);
     font.master_font_handle.idx = bx::kInvalidHandle;
+    font.file_handle = ttf_handle;
+    cached_files_[ttf_handle.idx].ref_count++;
     if (FontTypeNeedsMsdfGeneration(font_type)) {
-        font.face_handle = CreateFace(&cached_files_[ttf_handle.idx]);
+        font.face_handle = CreateFace(ttf_handle);
         font.msdf_gen_handle = CreateMsdfGenerator(font.face_handle, pixel_size, glyph_padding);
-        msdf_original_generator_->Init(cached_files_[ttf_handle.idx].path, cached_faces_[font.face_handle.idx], pixel_size, glyph_padding);
+        if (font_type == FontType::MsdfOriginal) {
+            font.msdf_original_generator = new MsdfOriginalGenerator();
+            font.msdf_original_generator->Init(cached_faces_[font.face_handle.idx].face, pixel_size, glyph_padding);
+        }
     } else {
         font.face_handle.idx = bx::kInvalidHandle;
         font.msdf_gen_handle.idx = bx::kInvalidHandle;
@@ -110,23 +130,54 @@ FontHandle FontManager::CreateFontByPixelSize(TrueTypeHandle ttf_handle, uint32_
     return handle;
 }
 
-FontFaceHandle FontManager::CreateFace(CachedFile* font_file) {
+FontFaceHandle FontManager::CreateFace(TrueTypeHandle ttf_handle) {
+    CachedFile &font_file = cached_files_[ttf_handle.idx];
+    if (isValid(font_file.face_handle)) {
+        cached_faces_[font_file.face_handle.idx].ref_count++;
+        return font_file.face_handle;
+    }
+    
     auto handle = FontFaceHandle{face_handles_.alloc()};
     BX_ASSERT(handle.idx != bx::kInvalidHandle, "Invalid handle used")
     
-    if (FT_New_Face(ft_library_, font_file->path, 0, &cached_faces_[handle.idx])) {
+    CachedFace &face = cached_faces_[handle.idx];
+    if (FT_New_Memory_Face(ft_library_, font_file.file.GetData(), (FT_Long) font_file.file.GetSize(), 0, &face.face)) {
         face_handles_.free(handle.idx);
         return FontFaceHandle{bx::kInvalidHandle};
     }
     
+    face.outline_cache = new OutlineCache(face.face);
+    face.file_handle = ttf_handle;
+    face.ref_count = 1;
+    font_file.face_handle = handle;
+    
     return handle;
 }
 
+void FontManager::ReleaseFace(FontFaceHandle face_handle) {
+    CachedFace &face = cached_faces_[face_handle.idx];
+    if (--face.ref_count > 0) {
+        return;
+    }
+    
+    delete face.outline_cache;
+    face.outline_cache = nullptr;
+    FT_Done_Face(face.face);
+    face.face = nullptr;
+    
+    CachedFile &font_file = cached_files_[face.file_handle.idx];
+    if (font_file.face_handle.idx == face_handle.idx) {
+        font_file.face_handle.idx = bx::kInvalidHandle;
+    }
+    face_handles_.free(face_handle.idx);
+}
+
 MsdfGenHandle FontManager::CreateMsdfGenerator(FontFaceHandle face_handle, uint32_t pixel_size, uint32_t padding) {
     auto handle = MsdfGenHandle{msdf_gen_handles_.alloc()};
     BX_ASSERT(handle.idx != bx::kInvalidHandle, "Invalid handle used")
     
-    cached_msdf_generators_[handle.idx].Init(cached_faces_[face_handle.idx], pixel_size, padding);
+    const CachedFace &face = cached_faces_[face_handle.idx];
+    cached_msdf_generators_[handle.idx].Init(face.face, face.outline_cache, pixel_size, padding);
     
     return handle;
 }
@@ -150,10 +201,15 @@ FontHandle FontManager::CreateScaledFontToPixelSize(FontHandle base_font_handle,
     BX_ASSERT(font_idx != bx::kInvalidHandle, "Invalid handle used")
 
     CachedFont &font = cached_fonts_[font_idx];
-    font.cached_glyphs.clear();
+    ClearCachedGlyphs(font);
+    font.progressive = false;
+    font.glyph_generation = 0;
     font.font_info = new_font_info;
     font.true_type_font = nullptr;
     font.master_font_handle = base_font_handle;
+    font.file_handle.idx = bx::kInvalidHandle;
+    font.face_handle.idx = bx::kInvalidHandle;
+    font.msdf_gen_handle.idx = bx::kInvalidHandle;
 
     FontHandle handle = {font_idx};
     return handle;
@@ -165,24 +221,104 @@ void FontManager::DestroyFont(FontHandle handle) {
     CachedFont &font = cached_fonts_[handle.idx];
 
     if (font.true_type_font != nullptr) {
+        // the glyphs of a scaled font share the regions of their master font without a reference
+        for (const auto &glyph: font.cached_glyphs) {
+            if (font.placeholder_glyphs.count(glyph.first) == 0) {
+                ReleaseSharedGlyph(font, glyph.second);
+            } else if (glyph.second.region_index != UINT16_MAX) {
+                atlas_->RemoveRegion(glyph.second.region_index);
+            }
+        }
+
         delete font.true_type_font;
         font.true_type_font = nullptr;
     }
 
-    font.cached_glyphs.clear();
+    ClearCachedGlyphs(font);
     if (isValid(handle)) {
         font_handles_.free(handle.idx);
     }
+
+    // the handle may be reused by another font, which didn't ask for these glyphs
+    for (auto &queue: glyph_queues_) {
+        const auto first_removed = std::remove_if(queue.begin(), queue.end(), [handle](const QueuedGlyph &glyph) {
+            return glyph.font_handle.idx == handle.idx;
+        });
+        queued_glyph_total_ -= (uint32_t) (queue.end() - first_removed);
+        queue.erase(first_removed, queue.end());
+    }
+    refine_queue_.erase(std::remove_if(refine_queue_.begin(), refine_queue_.end(), [handle](const QueuedGlyph &glyph) {
+        return glyph.font_handle.idx == handle.idx;
+    }), refine_queue_.end());
     
+    // the generator refers to the face, which refers to the mapped file
+    delete font.msdf_original_generator;
+    font.msdf_original_generator = nullptr;
+
     if (isValid(font.face_handle)) {
-        face_handles_.free(font.face_handle.idx);
+        ReleaseFace(font.face_handle);
+        font.face_handle.idx = bx::kInvalidHandle;
     }
     
     if (isValid(font.msdf_gen_handle)) {
         msdf_gen_handles_.free(font.msdf_gen_handle.idx);
+        font.msdf_gen_handle.idx = bx::kInvalidHandle;
+    }
+
+    if (isValid(font.file_handle)) {
+        ReleaseTtf(font.file_handle);
+        font.file_handle.idx = bx::kInvalidHandle;
     }
 }
 
+std::vector<uint16_t> FontManager::CompactAtlas() {
+    std::vector<uint16_t> remap = atlas_->Compact();
+    if (remap.empty()) {
+        return remap;
+    }
+
+    std::vector<CodePoint> removed_code_points;
+    for (uint16_t ii = 0; ii < font_handles_.getNumHandles(); ++ii) {
+        CachedFont &font = cached_fonts_[font_handles_.getHandleAt(ii)];
+
+        removed_code_points.clear();
+        for (auto &glyph: font.cached_glyphs) {
+            // glyphs that didn't fit in the atlas have no region to remap
+            if (glyph.second.region_index == UINT16_MAX) {
+                continue;
+            }
+
+            glyph.second.region_index = remap[glyph.second.region_index];
+            if (glyph.second.region_index == UINT16_MAX) {
+                removed_code_points.push_back(glyph.first);
+            }
+        }
+
+        // glyphs of a scaled font whose master font was destroyed
+        for (CodePoint code_point: removed_code_points) {
+            // tinystl only erases by iterator
+            const GlyphHashMap::const_iterator it = font.cached_glyphs.find(code_point);
+            if (it != font.cached_glyphs.end()) {
+                font.cached_glyphs.erase(it);
+            }
+            if (code_point >= 0 && code_point < LATIN1_GLYPH_COUNT) {
+                font.latin1_glyphs[code_point] = nullptr;
+            }
+        }
+    }
+
+    // a shared glyph is referenced by a live font, so its region is never removed
+    for (auto &shared_glyph: shared_glyphs_) {
+        shared_glyph.second.glyph_info.region_index = remap[shared_glyph.second.glyph_info.region_index];
+    }
+
+    if (has_black_glyph_) {
+        black_glyph_.region_index = remap[black_glyph_.region_index];
+    }
+
+    return remap;
+}
+
 bool FontManager::PreloadGlyph(FontHandle handle, const wchar_t *string) {
     BX_ASSERT(isValid(handle), "Invalid handle used")
     CachedFont &font = cached_fonts_[handle.idx];
@@ -206,48 +342,33 @@ bool FontManager::PreloadGlyph(FontHandle handle, CodePoint code_point) {
     CachedFont &font = cached_fonts_[handle.idx];
     FontInfo &font_info = font.font_info;
 
-    GlyphHashMap::iterator iter = font.cached_glyphs.find(code_point);
-    if (iter != font.cached_glyphs.end()) {
+    if (FindCachedGlyph(font, code_point) != nullptr) {
         return true;
     }
 
     if (font.true_type_font != nullptr) {
         GlyphInfo glyph_info {};
-        AtlasRegion::Type bitmap_type = AtlasRegion::TypeGray;
-
-        switch (font.font_info.font_type) {
-            case FontType::Bitmap:
-                font.true_type_font->BakeGlyphAlpha(code_point, glyph_info, buffer_);
-                break;
-            case FontType::SdfFromBitmap:
-                font.true_type_font->BakeGlyphSdf(code_point, glyph_info, buffer_);
-                break;
-            case FontType::SdfFromVector:
-                cached_msdf_generators_[font.msdf_gen_handle.idx].BakeGlyphSdf(code_point, glyph_info, buffer_);
-                bitmap_type = AtlasRegion::TypeBgra8; // todo check how to do this with single channel texture
-                break;
-            case FontType::Msdf:
-                cached_msdf_generators_[font.msdf_gen_handle.idx].BakeGlyphMsdf(code_point, glyph_info, buffer_);
-                bitmap_type = AtlasRegion::TypeBgra8;
-                break;
-            case FontType::MsdfOriginal:
-                msdf_original_generator_->BakeGlyphMsdf(code_point, glyph_info, buffer_);
-                bitmap_type = AtlasRegion::TypeBgra8;
-                break;
-            default:
-                BX_ASSERT(false, "TextureType not supported yet")
+        const int32_t glyph_index = font.true_type_font->GetGlyphIndex(code_point);
+        if (AcquireSharedGlyph(font, glyph_index, glyph_info)) {
+            ScaleGlyph(glyph_info, font_info.scale);
+            CacheGlyph(font, code_point, glyph_info);
+            return true;
         }
 
-        AddBitmap(glyph_info, buffer_, bitmap_type);
+        AtlasRegion::Type bitmap_type = AtlasRegion::TypeGray;
+        if (!GenerateGlyph(handle, code_point, buffer_, bitmap_type, glyph_info)) {
+            return false;
+        }
 
-        glyph_info.advance_x = (glyph_info.advance_x * font_info.scale);
-        glyph_info.advance_y = (glyph_info.advance_y * font_info.scale);
-        glyph_info.offset_x = (glyph_info.offset_x * font_info.scale);
-        glyph_info.offset_y = (glyph_info.offset_y * font_info.scale);
-        glyph_info.height = (glyph_info.height * font_info.scale);
-        glyph_info.width = (glyph_info.width * font_info.scale);
+        glyph_info.glyph_index = glyph_index;
+        // a glyph that doesn't fit in the atlas isn't cached, it is baked again on its next use
+        if (!AddBitmap(glyph_info, buffer_, bitmap_type)) {
+            return false;
+        }
+        ShareGlyph(font, glyph_info);
+        ScaleGlyph(glyph_info, font_info.scale);
 
-        font.cached_glyphs[code_point] = glyph_info;
+        CacheGlyph(font, code_point, glyph_info);
         return true;
     }
 
@@ -256,47 +377,373 @@ bool FontManager::PreloadGlyph(FontHandle handle, CodePoint code_point) {
         const GlyphInfo *glyph = GetGlyphInfo(font.master_font_handle, code_point);
 
         GlyphInfo glyph_info = *glyph;
-        glyph_info.advance_x = (glyph_info.advance_x * font_info.scale);
-        glyph_info.advance_y = (glyph_info.advance_y * font_info.scale);
-        glyph_info.offset_x = (glyph_info.offset_x * font_info.scale);
-        glyph_info.offset_y = (glyph_info.offset_y * font_info.scale);
-        glyph_info.height = (glyph_info.height * font_info.scale);
-        glyph_info.width = (glyph_info.width * font_info.scale);
-
-        font.cached_glyphs[code_point] = glyph_info;
+        ScaleGlyph(glyph_info, font_info.scale);
+
+        CacheGlyph(font, code_point, glyph_info);
         return true;
     }
 
     return false;
 }
 
+bool FontManager::PreloadGlyphs(FontHandle handle, const wchar_t *string) {
+    std::vector<CodePoint> code_points(string, string + wcslen(string));
+    return PreloadGlyphs(handle, code_points.data(), (uint32_t) code_points.size());
+}
+
+bool FontManager::PreloadGlyphs(FontHandle handle, const CodePoint *code_points, uint32_t count) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    CachedFont &font = cached_fonts_[handle.idx];
+    const FontInfo &font_info = font.font_info;
+
+    if (font.true_type_font == nullptr) {
+        if (!isValid(font.master_font_handle)) {
+            return false;
+        }
+
+        const bool all_preloaded = PreloadGlyphs(font.master_font_handle, code_points, count);
+        const CachedFont &master_font = cached_fonts_[font.master_font_handle.idx];
+        for (uint32_t ii = 0; ii < count; ++ii) {
+            const GlyphInfo *master_glyph_info = FindCachedGlyph(master_font, code_points[ii]);
+            if (master_glyph_info != nullptr && FindCachedGlyph(font, code_points[ii]) == nullptr) {
+                GlyphInfo glyph_info = *master_glyph_info;
+                ScaleGlyph(glyph_info, font_info.scale);
+                CacheGlyph(font, code_points[ii], glyph_info);
+            }
+        }
+        return all_preloaded;
+    }
+
+    std::vector<CodePoint> requested_code_points;
+    requested_code_points.reserve(count);
+    for (uint32_t ii = 0; ii < count; ++ii) {
+        if (FindCachedGlyph(font, code_points[ii]) == nullptr) {
+            requested_code_points.push_back(code_points[ii]);
+        }
+    }
+    std::sort(requested_code_points.begin(), requested_code_points.end());
+    requested_code_points.erase(std::unique(requested_code_points.begin(), requested_code_points.end()), requested_code_points.end());
+
+    // only one code point per glyph index is baked, the others (and the glyphs another font already baked)
+    // are copied from the shared glyphs once it is in the atlas. Resolving the glyph indices up front also
+    // lets the bake only read the font, so it can run on several threads.
+    std::vector<CodePoint> missing_code_points;
+    std::vector<CodePoint> shared_code_points;
+    std::unordered_set<int32_t> baked_glyph_indices;
+    for (CodePoint code_point: requested_code_points) {
+        const int32_t glyph_index = font.true_type_font->GetGlyphIndex(code_point);
+        if (shared_glyphs_.count(MakeGlyphKey(font, glyph_index)) != 0 || !baked_glyph_indices.insert(glyph_index).second) {
+            shared_code_points.push_back(code_point);
+        } else {
+            missing_code_points.push_back(code_point);
+        }
+    }
+
+    bool all_preloaded = true;
+    const auto glyph_count = (uint32_t) missing_code_points.size();
+    if (glyph_count == 0) {
+        for (CodePoint code_point: shared_code_points) {
+            all_preloaded &= PreloadGlyph(handle, code_point);
+        }
+        return all_preloaded;
+    }
+
+    std::vector<BakedGlyph> baked_glyphs(glyph_count);
+    if (FontTypeNeedsMsdfGeneration(font_info.font_type)) {
+        // the msdf generators share their outline cache and scratch memory, so they bake one glyph at a time
+        uint32_t baked_count = 0;
+        for (CodePoint code_point: missing_code_points) {
+            BakedGlyph &baked = baked_glyphs[baked_count];
+            baked.code_point = code_point;
+            baked.bitmap_type = AtlasRegion::TypeGray;
+            baked.glyph_info = GlyphInfo{};
+            if (!GenerateGlyph(handle, code_point, buffer_, baked.bitmap_type, baked.glyph_info)) {
+                all_preloaded = false;
+                continue;
+            }
+            const size_t bitmap_size = (size_t) bx::ceil(baked.glyph_info.width) * (size_t) bx::ceil(baked.glyph_info.height)
+                                       * (baked.bitmap_type == AtlasRegion::TypeBgra8 ? 4 : 1);
+            baked.bitmap.assign(buffer_, buffer_ + bitmap_size);
+            baked_count++;
+        }
+        baked_glyphs.resize(baked_count);
+    } else {
+        const uint32_t max_thread_count = (glyph_count + MIN_GLYPHS_PER_BAKE_THREAD - 1) / MIN_GLYPHS_PER_BAKE_THREAD;
+        const uint32_t thread_count = bx::clamp<uint32_t>(std::thread::hardware_concurrency(), 1, max_thread_count);
+        const uint32_t glyphs_per_thread = (glyph_count + thread_count - 1) / thread_count;
+
+        std::vector<std::thread> threads;
+        for (uint32_t first = glyphs_per_thread; first < glyph_count; first += glyphs_per_thread) {
+            threads.emplace_back(BakeGlyphs, font.true_type_font, font_info.font_type, missing_code_points.data() + first,
+                                 bx::min(glyphs_per_thread, glyph_count - first), baked_glyphs.data() + first);
+        }
+        BakeGlyphs(font.true_type_font, font_info.font_type, missing_code_points.data(), bx::min(glyphs_per_thread, glyph_count), baked_glyphs.data());
+
+        for (auto &thread: threads) {
+            thread.join();
+        }
+    }
+
+    // tallest first, so every row of the packer is filled with glyphs of a similar height
+    std::stable_sort(baked_glyphs.begin(), baked_glyphs.end(), [](const BakedGlyph &a, const BakedGlyph &b) {
+        if (a.glyph_info.height != b.glyph_info.height) {
+            return a.glyph_info.height > b.glyph_info.height;
+        }
+        return a.glyph_info.width * a.glyph_info.height > b.glyph_info.width * b.glyph_info.height;
+    });
+
+    atlas_->BeginBatch();
+    for (auto &baked: baked_glyphs) {
+        baked.glyph_info.glyph_index = font.true_type_font->GetGlyphIndex(baked.code_point);
+        // a glyph that doesn't fit in the atlas isn't cached, it is baked again on its next use
+        if (!AddBitmap(baked.glyph_info, baked.bitmap.data(), baked.bitmap_type)) {
+            all_preloaded = false;
+            continue;
+        }
+        ShareGlyph(font, baked.glyph_info);
+        ScaleGlyph(baked.glyph_info, font_info.scale);
+        CacheGlyph(font, baked.code_point, baked.glyph_info);
+    }
+    // the code points sharing a glyph that didn't fit try to bake it again on their own
+    for (CodePoint code_point: shared_code_points) {
+        all_preloaded &= PreloadGlyph(handle, code_point);
+    }
+    atlas_->EndBatch();
+
+    return all_preloaded;
+}
+
+void FontManager::SetProgressive(FontHandle handle, bool progressive) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    CachedFont &font = cached_fonts_[handle.idx];
+    // the other font types are cheap enough to bake right away, the placeholders come from the same generator
+    // as the real glyphs so they have the same metrics
+    const FontType font_type = font.font_info.font_type;
+    font.progressive = progressive && font.true_type_font != nullptr && (font_type == FontType::Msdf || font_type == FontType::SdfFromVector);
+}
+
+uint32_t FontManager::GetGlyphGeneration(FontHandle handle) const {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    return cached_fonts_[handle.idx].glyph_generation;
+}
+
+bool FontManager::AddPlaceholderGlyph(FontHandle handle, CodePoint code_point) {
+    CachedFont &font = cached_fonts_[handle.idx];
+    const int32_t glyph_index = font.true_type_font->GetGlyphIndex(code_point);
+    // another font may have baked the real glyph already
+    if (FindCachedGlyph(font, code_point) != nullptr || shared_glyphs_.count(MakeGlyphKey(font, glyph_index)) != 0) {
+        return false;
+    }
+
+    // the same distance in every channel, so the median of an msdf shader reads it as well
+    GlyphInfo glyph_info{};
+    if (!cached_msdf_generators_[font.msdf_gen_handle.idx].BakeGlyphPlaceholder(code_point, glyph_info, buffer_)) {
+        return false;
+    }
+
+    glyph_info.glyph_index = glyph_index;
+    if (!AddBitmap(glyph_info, buffer_, AtlasRegion::TypeBgra8)) {
+        return false;
+    }
+    ScaleGlyph(glyph_info, font.font_info.scale);
+    CacheGlyph(font, code_point, glyph_info);
+
+    font.placeholder_glyphs.insert(code_point);
+    refine_queue_.push_back({handle, code_point});
+    return true;
+}
+
+bool FontManager::RefineGlyph(FontHandle handle, CodePoint code_point) {
+    CachedFont &font = cached_fonts_[handle.idx];
+    const uint16_t placeholder_region_index = FindCachedGlyph(font, code_point)->region_index;
+
+    GlyphInfo glyph_info{};
+    const int32_t glyph_index = font.true_type_font->GetGlyphIndex(code_point);
+    if (!AcquireSharedGlyph(font, glyph_index, glyph_info)) {
+        AtlasRegion::Type bitmap_type = AtlasRegion::TypeGray;
+        if (!GenerateGlyph(handle, code_point, buffer_, bitmap_type, glyph_info)) {
+            return false;
+        }
+        glyph_info.glyph_index = glyph_index;
+        // the placeholder keeps its region and stays in placeholder_glyphs, so it is still drawn and released
+        if (!AddBitmap(glyph_info, buffer_, bitmap_type)) {
+            return false;
+        }
+        ShareGlyph(font, glyph_info);
+    }
+    font.placeholder_glyphs.erase(code_point);
+
+    // the text laid out with the placeholder keeps drawing it until the next compaction
+    atlas_->RemoveRegion(placeholder_region_index);
+
+    GlyphInfo scaled_glyph_info = glyph_info;
+    ScaleGlyph(scaled_glyph_info, font.font_info.scale);
+    CacheGlyph(font, code_point, scaled_glyph_info);
+    font.glyph_generation++;
+    // the metrics match the placeholder, but measurements are never kept across a change of glyph
+    font.measure_cache.clear();
+
+    // the scaled fonts copied the placeholder
+    for (uint16_t ii = 0; ii < font_handles_.getNumHandles(); ++ii) {
+        CachedFont &scaled_font = cached_fonts_[font_handles_.getHandleAt(ii)];
+        if (scaled_font.master_font_handle.idx != handle.idx) {
+            continue;
+        }
+
+        scaled_font.measure_cache.clear();
+        if (FindCachedGlyph(scaled_font, code_point) != nullptr) {
+            scaled_glyph_info = glyph_info;
+            ScaleGlyph(scaled_glyph_info, scaled_font.font_info.scale);
+            CacheGlyph(scaled_font, code_point, scaled_glyph_info);
+            scaled_font.glyph_generation++;
+        }
+    }
+    return true;
+}
+
+void FontManager::QueueGlyphs(FontHandle handle, const wchar_t *string, GlyphPriority::Enum priority) {
+    std::vector<CodePoint> code_points(string, string + wcslen(string));
+    QueueGlyphs(handle, code_points.data(), (uint32_t) code_points.size(), priority);
+}
+
+void FontManager::QueueGlyphs(FontHandle handle, const CodePoint *code_points, uint32_t count, GlyphPriority::Enum priority) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    const CachedFont &font = cached_fonts_[handle.idx];
+
+    for (uint32_t ii = 0; ii < count; ++ii) {
+        if (FindCachedGlyph(font, code_points[ii]) == nullptr) {
+            glyph_queues_[priority].push_back({handle, code_points[ii]});
+            queued_glyph_total_++;
+        }
+    }
+}
+
+GlyphBakeProgress FontManager::Pump(uint32_t time_budget_us) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    GlyphBakeProgress progress{};
+    bool out_of_time = false;
+    uint32_t attempted_count = 0;
+
+    // bake a glyph if it is expected to fit in what is left of the budget, the first one is always baked
+    auto bake_within_budget = [&](FontType font_type, const auto &bake) {
+        float &estimate_us = bake_time_estimates_us_[(int) font_type];
+        const Clock::time_point bake_start = Clock::now();
+        const auto elapsed_us = (float) std::chrono::duration_cast<std::chrono::microseconds>(bake_start - start).count();
+        if (attempted_count > 0 && elapsed_us + estimate_us > (float) time_budget_us) {
+            out_of_time = true;
+            return false;
+        }
+
+        bake();
+        attempted_count++;
+
+        const auto bake_time_us = (float) std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - bake_start).count();
+        estimate_us = estimate_us == 0.0f ? bake_time_us : estimate_us * 0.75f + bake_time_us * 0.25f;
+        return true;
+    };
+
+    atlas_->BeginBatch();
+    for (uint32_t priority = 0; priority < GlyphPriority::Count && !out_of_time; ++priority) {
+        std::deque<QueuedGlyph> &queue = glyph_queues_[priority];
+        while (!queue.empty()) {
+            const QueuedGlyph glyph = queue.front();
+            const CachedFont &font = cached_fonts_[glyph.font_handle.idx];
+
+            // queued more than once, or already loaded by a draw
+            if (FindCachedGlyph(font, glyph.code_point) == nullptr) {
+                if (!bake_within_budget(font.font_info.font_type, [&] { PreloadGlyph(glyph.font_handle, glyph.code_point); })) {
+                    break;
+                }
+                progress.baked_count++;
+            }
+
+            queue.pop_front();
+            queued_glyph_completed_++;
+        }
+    }
+
+    while (!out_of_time && !refine_queue_.empty()) {
+        const QueuedGlyph glyph = refine_queue_.front();
+        const CachedFont &font = cached_fonts_[glyph.font_handle.idx];
+
+        if (font.placeholder_glyphs.count(glyph.code_point) != 0) {
+            bool refined = false;
+            if (!bake_within_budget(font.font_info.font_type, [&] { refined = RefineGlyph(glyph.font_handle, glyph.code_point); })) {
+                break;
+            }
+            progress.refined_count += refined ? 1 : 0;
+        }
+
+        refine_queue_.pop_front();
+    }
+    atlas_->EndBatch();
+
+    for (const auto &queue: glyph_queues_) {
+        progress.pending_count += (uint32_t) queue.size();
+    }
+    progress.pending_refinement_count = (uint32_t) refine_queue_.size();
+    progress.completed_count = queued_glyph_completed_;
+    progress.total_count = queued_glyph_total_;
+
+    if (progress.pending_count == 0) {
+        queued_glyph_completed_ = 0;
+        queued_glyph_total_ = 0;
+    }
+    return progress;
+}
+
+void FontManager::BakeGlyphs(TrueTypeFont *font, FontType font_type, const CodePoint *code_points, uint32_t count, BakedGlyph *baked_glyphs) {
+    std::vector<uint8_t> buffer(MAX_FONT_BUFFER_SIZE);
+
+    for (uint32_t ii = 0; ii < count; ++ii) {
+        BakedGlyph &baked = baked_glyphs[ii];
+        baked.code_point = code_points[ii];
+        baked.bitmap_type = AtlasRegion::TypeGray;
+
+        if (font_type == FontType::Bitmap) {
+            font->BakeGlyphAlpha(baked.code_point, baked.glyph_info, buffer.data());
+        } else {
+            font->BakeGlyphSdf(baked.code_point, baked.glyph_info, buffer.data());
+        }
+
+        baked.bitmap.assign(buffer.begin(), buffer.begin() + (size_t) bx::ceil(baked.glyph_info.width) * (size_t) bx::ceil(baked.glyph_info.height));
+    }
+}
+
+void FontManager::ScaleGlyph(GlyphInfo &glyph_info, float scale) {
+    glyph_info.advance_x = (glyph_info.advance_x * scale);
+    glyph_info.advance_y = (glyph_info.advance_y * scale);
+    glyph_info.offset_x = (glyph_info.offset_x * scale);
+    glyph_info.offset_y = (glyph_info.offset_y * scale);
+    glyph_info.height = (glyph_info.height * scale);
+    glyph_info.width = (glyph_info.width * scale);
+}
+
 bool FontManager::GenerateGlyph(FontHandle handle, CodePoint code_point, uint8_t *output, AtlasRegion::Type& bitmap_type, GlyphInfo& glyph_info) {
     CachedFont &font = cached_fonts_[handle.idx];
     
     switch (font.font_info.font_type) {
         case FontType::Bitmap:
             font.true_type_font->BakeGlyphAlpha(code_point, glyph_info, output);
-            break;
+            return true;
         case FontType::SdfFromBitmap:
+            // false only means the glyph is empty, its metrics are still valid
             font.true_type_font->BakeGlyphSdf(code_point, glyph_info, output);
-            break;
+            return true;
         case FontType::SdfFromVector:
-            cached_msdf_generators_[font.msdf_gen_handle.idx].BakeGlyphSdf(code_point, glyph_info, output);
-            bitmap_type = AtlasRegion::TypeBgra8;
-            break;
+            bitmap_type = AtlasRegion::TypeBgra8; // todo check how to do this with single channel texture
+            return cached_msdf_generators_[font.msdf_gen_handle.idx].BakeGlyphSdf(code_point, glyph_info, output);
         case FontType::Msdf:
-            cached_msdf_generators_[font.msdf_gen_handle.idx].BakeGlyphMsdf(code_point, glyph_info, output);
             bitmap_type = AtlasRegion::TypeBgra8;
-            break;
+            return cached_msdf_generators_[font.msdf_gen_handle.idx].BakeGlyphMsdf(code_point, glyph_info, output);
         case FontType::MsdfOriginal:
-            msdf_original_generator_->BakeGlyphMsdf(code_point, glyph_info, output);
             bitmap_type = AtlasRegion::TypeBgra8;
-            break;
+            return font.msdf_original_generator->BakeGlyphMsdf(code_point, glyph_info, output);
         default:
             BX_ASSERT(false, "TextureType not supported yet")
+            return false;
     }
-    
-    return true;
 }
 
 const FontInfo &FontManager::GetFontInfo(FontHandle handle) const {
@@ -308,31 +755,278 @@ float FontManager::GetKerning(FontHandle handle, CodePoint prev_code_point, Code
     const CachedFont &cached_font = cached_fonts_[handle.idx];
     if (isValid(cached_font.master_font_handle)) {
         CachedFont &base_font = cached_fonts_[cached_font.master_font_handle.idx];
-        return base_font.true_type_font->scale_ * stbtt_GetCodepointKernAdvance(&base_font.true_type_font->font_, prev_code_point, code_point) * cached_font.font_info.scale;
+        return base_font.true_type_font->GetKerning(prev_code_point, code_point) * cached_font.font_info.scale;
     } else {
-        return cached_font.true_type_font->scale_ * stbtt_GetCodepointKernAdvance(&cached_font.true_type_font->font_, prev_code_point, code_point);
+        return cached_font.true_type_font->GetKerning(prev_code_point, code_point);
     }
 }
 
 const GlyphInfo *FontManager::GetGlyphInfo(FontHandle handle, CodePoint code_point) {
-    const GlyphHashMap &cached_glyphs = cached_fonts_[handle.idx].cached_glyphs;
-    GlyphHashMap::const_iterator it = cached_glyphs.find(code_point);
+    const CachedFont &font = cached_fonts_[handle.idx];
+    const GlyphInfo *glyph_info = FindCachedGlyph(font, code_point);
+
+    if (glyph_info == nullptr) {
+        // a scaled font copies the placeholder of its master font
+        const FontHandle owner_handle = isValid(font.master_font_handle) ? font.master_font_handle : handle;
+        if (cached_fonts_[owner_handle.idx].progressive) {
+            AddPlaceholderGlyph(owner_handle, code_point);
+        }
 
-    if (it == cached_glyphs.end()) {
         if (!PreloadGlyph(handle, code_point)) {
             return nullptr;
         }
 
-        it = cached_glyphs.find(code_point);
+        glyph_info = FindCachedGlyph(font, code_point);
+    }
+
+    BX_ASSERT(glyph_info != nullptr, "Failed to preload glyph.")
+    return glyph_info;
+}
+
+const GlyphInfo *FontManager::FindCachedGlyph(const CachedFont &font, CodePoint code_point) {
+    // most of the text is latin-1, so skip the hash map for it
+    if (code_point >= 0 && code_point < LATIN1_GLYPH_COUNT) {
+        return font.latin1_glyphs[code_point];
     }
 
-    BX_ASSERT(it != cached_glyphs.end(), "Failed to preload glyph.")
-    return &it->second;
+    GlyphHashMap::const_iterator it = font.cached_glyphs.find(code_point);
+    return it != font.cached_glyphs.end() ? &it->second : nullptr;
+}
+
+void FontManager::CacheGlyph(CachedFont &font, CodePoint code_point, const GlyphInfo &glyph_info) {
+    GlyphInfo &cached_glyph = font.cached_glyphs[code_point];
+    cached_glyph = glyph_info;
+
+    if (code_point >= 0 && code_point < LATIN1_GLYPH_COUNT) {
+        font.latin1_glyphs[code_point] = &cached_glyph;
+    }
+}
+
+void FontManager::ClearCachedGlyphs(CachedFont &font) {
+    font.cached_glyphs.clear();
+    font.placeholder_glyphs.clear();
+    bx::memSet(font.latin1_glyphs, 0, sizeof(font.latin1_glyphs));
+    font.measure_cache.clear();
+}
+
+size_t FontManager::GlyphKeyHash::operator()(const GlyphKey &key) const {
+    uint64_t hash = ((uint64_t) key.file_id << 32) | (uint32_t) key.glyph_index;
+    hash ^= ((uint64_t) key.pixel_size << 40) ^ ((uint64_t) (uint16_t) key.padding << 24)
+            ^ ((uint64_t) key.typeface_index << 16) ^ (uint64_t) key.font_type;
+    return std::hash<uint64_t>()(hash);
+}
+
+FontManager::GlyphKey FontManager::MakeGlyphKey(const CachedFont &font, int32_t glyph_index) {
+    GlyphKey key = font.glyph_key;
+    key.glyph_index = glyph_index;
+    return key;
+}
+
+bool FontManager::AcquireSharedGlyph(const CachedFont &font, int32_t glyph_index, GlyphInfo &out_glyph_info) {
+    auto it = shared_glyphs_.find(MakeGlyphKey(font, glyph_index));
+    if (it == shared_glyphs_.end()) {
+        return false;
+    }
+
+    it->second.ref_count++;
+    out_glyph_info = it->second.glyph_info;
+    return true;
+}
+
+void FontManager::ShareGlyph(const CachedFont &font, const GlyphInfo &glyph_info) {
+    // a glyph that didn't fit in the atlas is baked again next time, there may be room by then
+    if (glyph_info.region_index == UINT16_MAX) {
+        return;
+    }
+
+    shared_glyphs_[MakeGlyphKey(font, glyph_info.glyph_index)] = SharedGlyph{glyph_info, 1};
+}
+
+void FontManager::ReleaseSharedGlyph(const CachedFont &font, const GlyphInfo &glyph_info) {
+    if (glyph_info.region_index == UINT16_MAX) {
+        return;
+    }
+
+    auto it = shared_glyphs_.find(MakeGlyphKey(font, glyph_info.glyph_index));
+    BX_ASSERT(it != shared_glyphs_.end(), "The glyph was not shared")
+    if (--it->second.ref_count == 0) {
+        atlas_->RemoveRegion(it->second.glyph_info.region_index);
+        shared_glyphs_.erase(it);
+    }
+}
+
+TextRectangle FontManager::MeasureText(FontHandle handle, const char *string, const char *end, bool use_cache) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BX_ASSERT(end == nullptr || end >= string, "")
+
+    if (end == nullptr) {
+        end = string + bx::strLen(string);
+    }
+
+    CachedFont &font = cached_fonts_[handle.idx];
+    uint64_t key = 0;
+    if (use_cache) {
+        key = std::hash<std::string_view>()(std::string_view(string, end - string));
+        auto it = font.measure_cache.find(key);
+        if (it != font.measure_cache.end() && it->second.text.compare(0, std::string::npos, string, end - string) == 0) {
+            return it->second.rectangle;
+        }
+    }
+
+    MeasureState state{};
+    uint32_t code_point = 0;
+    uint32_t utf8_state = UTF8_ACCEPT;
+    const char *current = string;
+
+    uint32_t code_points[256];
+    uint32_t count;
+    do {
+        count = Utf8DecodeBatch(&utf8_state, &code_point, &current, end, code_points, BX_COUNTOF(code_points));
+        for (uint32_t ii = 0; ii < count; ++ii) {
+            MeasureGlyph(handle, (CodePoint) code_points[ii], state);
+        }
+    } while (count == BX_COUNTOF(code_points));
+
+    if (use_cache) {
+        if (font.measure_cache.size() >= MAX_MEASURE_CACHE_ENTRIES) {
+            font.measure_cache.clear();
+        }
+        font.measure_cache[key] = MeasuredText{std::string(string, end - string), state.rectangle};
+    }
+
+    return state.rectangle;
+}
+
+TextRectangle FontManager::MeasureText(FontHandle handle, const wchar_t *string, const wchar_t *end) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+
+    if (end == nullptr) {
+        end = string + wcslen(string);
+    }
+    BX_ASSERT(end >= string, "")
+
+    MeasureState state{};
+    for (const wchar_t *current = string; current < end; ++current) {
+        MeasureGlyph(handle, (CodePoint) *current, state);
+    }
+
+    return state.rectangle;
+}
+
+void FontManager::ClearMeasureCache(FontHandle handle) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    cached_fonts_[handle.idx].measure_cache.clear();
+}
+
+void FontManager::MeasureGlyph(FontHandle handle, CodePoint code_point, MeasureState &state) {
+    // keep in sync with TextBuffer::AppendGlyph
+    if (code_point == L'\t') {
+        for (uint32_t ii = 0; ii < 4; ++ii) {
+            MeasureGlyph(handle, L' ', state);
+        }
+        return;
+    }
+
+    // measuring text doesn't add its glyphs to the atlas, only their advance is needed
+    GlyphInfo glyph{};
+    if (!GetGlyphMetrics(handle, code_point, glyph)) {
+        state.previous_code_point = 0;
+        return;
+    }
+
+    const FontInfo &font = GetFontInfo(handle);
+
+    if (code_point == L'\n') {
+        state.pen_x = 0;
+        state.pen_y += state.line_gap + state.line_ascender - state.line_descender;
+        state.line_gap = font.line_gap;
+        state.line_descender = font.descender;
+        state.line_ascender = font.ascender;
+        state.previous_code_point = 0;
+        return;
+    }
+
+    if (font.ascender > state.line_ascender || font.descender < state.line_descender) {
+        if (font.descender < state.line_descender) {
+            state.line_descender = font.descender;
+        }
+        state.line_ascender = font.ascender;
+        state.line_gap = font.line_gap;
+    }
+
+    state.pen_x += GetKerning(handle, state.previous_code_point, code_point);
+    state.pen_x += glyph.advance_x;
+    if (state.pen_x > state.rectangle.width) {
+        state.rectangle.width = state.pen_x;
+    }
+
+    const float line_bottom = state.pen_y + state.line_ascender - state.line_descender + state.line_gap;
+    if (line_bottom > state.rectangle.height) {
+        state.rectangle.height = line_bottom;
+    }
+
+    state.previous_code_point = code_point;
+}
+
+bool FontManager::GetGlyphMetrics(FontHandle handle, CodePoint code_point, GlyphInfo &out_glyph_info) {
+    const CachedFont &font = cached_fonts_[handle.idx];
+    const GlyphInfo *cached_glyph = FindCachedGlyph(font, code_point);
+    if (cached_glyph != nullptr) {
+        out_glyph_info = *cached_glyph;
+        return true;
+    }
+
+    // a scaled font bakes its glyphs with its master font
+    const CachedFont &owner = isValid(font.master_font_handle) ? cached_fonts_[font.master_font_handle.idx] : font;
+    if (owner.true_type_font == nullptr) {
+        return false;
+    }
+
+    switch (owner.font_info.font_type) {
+        case FontType::Bitmap:
+        case FontType::SdfFromBitmap:
+            out_glyph_info = owner.true_type_font->GetGlyphInfo(code_point);
+            break;
+        case FontType::SdfFromVector:
+        case FontType::Msdf:
+            cached_msdf_generators_[owner.msdf_gen_handle.idx].GetGlyphMetrics(code_point, out_glyph_info);
+            break;
+        case FontType::MsdfOriginal:
+            owner.msdf_original_generator->CalculateGlyphInfo(out_glyph_info, code_point);
+            break;
+        default: {
+            // no metrics without baking for the other types
+            const GlyphInfo *glyph_info = GetGlyphInfo(handle, code_point);
+            if (glyph_info == nullptr) {
+                return false;
+            }
+            out_glyph_info = *glyph_info;
+            return true;
+        }
+    }
+
+    ScaleGlyph(out_glyph_info, font.font_info.scale);
+    return true;
+}
+
+const GlyphInfo &FontManager::GetBlackGlyph() {
+    if (!has_black_glyph_) {
+        const uint32_t size = 3;
+        uint8_t buffer[size * size * 4];
+        bx::memSet(buffer, 255, sizeof(buffer));
+
+        black_glyph_.width = size;
+        black_glyph_.height = size;
+        // a one pixel inner outline makes sure the sampled color doesn't bleed
+        black_glyph_.region_index = atlas_->AddRegion(size, size, buffer, AtlasRegion::TypeGray, 1);
+        has_black_glyph_ = true;
+    }
+    return black_glyph_;
 }
 
 bool FontManager::AddBitmap(GlyphInfo &glyph_info, const uint8_t *data, const AtlasRegion::Type bitmap_type) {
     glyph_info.region_index = atlas_->AddRegion((uint16_t) bx::ceil(glyph_info.width), (uint16_t) bx::ceil(glyph_info.height), data, bitmap_type);
-    return true;
+    return glyph_info.region_index != UINT16_MAX;
 }
 
 bool FontManager::FontTypeNeedsMsdfGeneration(FontType font_type) {
@@ -10,7 +10,11 @@
 #include <bx/handlealloc.h>
 #include <bx/string.h>
 #include <freetype/freetype.h>
+#include <deque>
 #include <vector>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <tinystl/allocator.h>
 #include <tinystl/unordered_map.h>
 
@@ -21,11 +25,14 @@
 #include "../sdf/MsdfGenerator.h"
 #include "../font_processing/AtlasRegion.h"
 #include "../sdf/MsdfOriginalGenerator.h"
+#include "../helper/MappedFile.h"
 
 class Atlas;
 
 #define MAX_OPENED_FILES 64
 #define MAX_OPENED_FONT  64
+#define LATIN1_GLYPH_COUNT 256
+#define MAX_MEASURE_CACHE_ENTRIES 1024
 #define MAX_OPENED_FACES 64
 #define MAX_OPENED_MSDF_GEN 8
 #define FONT_TYPE_ALPHA UINT32_C(0x00000100)
@@ -36,8 +43,79 @@ namespace stl = tinystl;
 typedef int32_t CodePoint;
 typedef stl::unordered_map<CodePoint, GlyphInfo> GlyphHashMap;
 
+/// how soon a glyph queued with FontManager::QueueGlyphs is needed, the more urgent ones are baked first
+struct GlyphPriority {
+    enum Enum {
+        /// on screen already, drawn without it until it is baked
+        Visible,
+        /// likely to be shown in the next frames
+        Soon,
+        /// warming up the atlas, e.g. on a loading screen or while streaming a level
+        Prefetch,
+
+        Count
+    };
+};
+
+/// progress of the queued glyphs reported by FontManager::Pump
+struct GlyphBakeProgress {
+    /// glyphs baked and added to the atlas by this call
+    uint32_t baked_count;
+    /// glyphs still queued
+    uint32_t pending_count;
+    /// placeholder glyphs replaced by their refined version by this call, a placeholder whose glyph doesn't fit in
+    /// the atlas is kept and not refined again
+    uint32_t refined_count;
+    /// placeholder glyphs still waiting for their refined version
+    uint32_t pending_refinement_count;
+    /// glyphs done out of all the glyphs queued since the queue was last empty, e.g. for a loading bar
+    uint32_t completed_count;
+    uint32_t total_count;
+};
+
 class FontManager {
+    // reads the font state directly while building a snapshot
+    friend class GlyphSnapshot;
+
 private:
+    struct MeasuredText {
+        std::string text;
+        TextRectangle rectangle;
+    };
+    // pen and line state used while measuring a text, mirrors the layout state of a TextBuffer
+    struct MeasureState {
+        float pen_x;
+        float pen_y;
+        float line_ascender;
+        float line_descender;
+        float line_gap;
+        CodePoint previous_code_point;
+        TextRectangle rectangle;
+    };
+    // identifies the content a glyph is baked to, glyphs with the same key share their atlas region, whether
+    // they come from different fonts over the same file or from code points mapped to the same glyph index
+    struct GlyphKey {
+        // CachedFile::file_id of the font file
+        uint32_t file_id;
+        int32_t typeface_index;
+        int32_t glyph_index;
+        uint32_t pixel_size;
+        int16_t padding;
+        FontType font_type;
+
+        bool operator==(const GlyphKey &other) const {
+            return file_id == other.file_id && typeface_index == other.typeface_index && glyph_index == other.glyph_index
+                   && pixel_size == other.pixel_size && padding == other.padding && font_type == other.font_type;
+        }
+    };
+    struct GlyphKeyHash {
+        size_t operator()(const GlyphKey &key) const;
+    };
+    // an unscaled glyph in the atlas and the number of cached glyphs of truetype fonts using its region
+    struct SharedGlyph {
+        GlyphInfo glyph_info;
+        uint32_t ref_count;
+    };
     struct CachedFont {
         CachedFont() : true_type_font(nullptr) {
             master_font_handle.idx = bx::kInvalidHandle;
@@ -45,19 +123,54 @@ private:
 
         FontInfo font_info{};
         GlyphHashMap cached_glyphs;
+        // direct lookup for the latin-1 code points, pointing into cached_glyphs (its nodes never move)
+        const GlyphInfo *latin1_glyphs[LATIN1_GLYPH_COUNT]{};
+        // results of MeasureText, keyed by the hash of the measured string
+        std::unordered_map<uint64_t, MeasuredText> measure_cache;
         TrueTypeFont *true_type_font;
+        // the file and settings the glyphs of a truetype font are baked with, the glyph index is set per glyph
+        GlyphKey glyph_key{};
+        // see SetProgressive, the code points in placeholder_glyphs wait for Pump to refine them
+        bool progressive{};
+        std::unordered_set<CodePoint> placeholder_glyphs;
+        // incremented every time glyphs of the font are refined, see GetGlyphGeneration
+        uint32_t glyph_generation{};
         // a handle to a master font in case of sub distance field font
         FontHandle master_font_handle{};
         int16_t padding{};
+        // the file of a truetype font, holding a reference that keeps it mapped
+        TrueTypeHandle file_handle{};
         // used for msdf rendering
         FontFaceHandle face_handle{};
         MsdfGenHandle msdf_gen_handle{};
+        // msdfgen adopts the face of this font, so every MsdfOriginal font has its own generator
+        MsdfOriginalGenerator *msdf_original_generator{};
     };
     struct CachedFile {
-        uint8_t *buffer;
-        uint32_t buffer_size;
-        const char* path;
+        // the file is mapped once and read directly by stb_truetype, freetype and msdfgen
+        MappedFile file;
+        // unlike the handle it is never reused, so a new file can't pick up the shared glyphs of a closed one
+        uint32_t file_id;
+        // freetype face shared by all the fonts created from this file
+        FontFaceHandle face_handle;
+        // the handle returned by CreateTtf and every truetype font created from the file, the file is
+        // unmapped with the last one since stb_truetype and freetype read straight from the mapping
+        uint16_t ref_count;
     }; 
+    struct CachedFace {
+        FT_Face face;
+        // decomposed outlines shared by all the msdf generators of this face
+        OutlineCache *outline_cache;
+        TrueTypeHandle file_handle;
+        uint16_t ref_count;
+    };
+    // a glyph rasterized by PreloadGlyphs, waiting to be added to the atlas
+    struct BakedGlyph {
+        CodePoint code_point;
+        GlyphInfo glyph_info;
+        AtlasRegion::Type bitmap_type;
+        std::vector<uint8_t> bitmap;
+    };
      
 public:
     /// Create the font manager using an external cube atlas (doesn't take ownership of the atlas).
@@ -73,28 +186,54 @@ public:
         return atlas_;
     }
 
-    /// Load a TrueType font from a given buffer. The buffer is copied and
-    /// thus can be freed or reused after this call.
+    /// Load a TrueType font from a file. The file is memory mapped and shared
+    /// by all the fonts created from it.
     ///
     /// @return invalid handle if the loading fail
     TrueTypeHandle CreateTtf(const char* font_path);
     
     /// Unload a TrueType font (free font memory) but keep loaded glyphs.
+    /// @remark the file stays mapped until the fonts created from it are destroyed
     void DestroyTtf(TrueTypeHandle handle);
 
     /// Return a font whose height is a fixed pixel size.
+    /// @remark fonts created from the same file with the same typeface, pixel size, type and padding share
+    ///   the glyphs in the atlas, each of them is baked once
     FontHandle CreateFontByPixelSize(TrueTypeHandle ttf_handle, uint32_t typeface_index, uint32_t pixel_size,
                                      FontType font_type = FontType::Bitmap, uint16_t glyph_padding = 6);
 
-    FontFaceHandle CreateFace(CachedFile* font_file);
+    /// Return the face of a font file, the face is created on first use and shared between all fonts of the file.
+    FontFaceHandle CreateFace(TrueTypeHandle ttf_handle);
+    void ReleaseFace(FontFaceHandle face_handle);
+    /// drop a reference to a font file, the file is unmapped and its handle freed with the last one
+    void ReleaseTtf(TrueTypeHandle handle);
     MsdfGenHandle CreateMsdfGenerator(FontFaceHandle face_handle, uint32_t pixel_size, uint32_t padding);
 
     /// Return a scaled child font whose height is a fixed pixel size.
     FontHandle CreateScaledFontToPixelSize(FontHandle base_font_handle, uint32_t pixel_size);
 
+    /// Serve the first request of a glyph (GetGlyphInfo, so the text being laid out) with a cheap placeholder,
+    /// only the inside of the outline without distances, and bake the real glyph later in Pump. Text is never
+    /// missing while the expensive msdf glyphs are baked in the background, and doesn't move when they replace
+    /// the placeholders. The glyphs preloaded explicitly are baked in full.
+    /// @remark only applies to msdf and sdf from vector fonts, the scaled fonts of a progressive font get its
+    ///   placeholders too
+    void SetProgressive(FontHandle handle, bool progressive);
+
+    /// Return a number incremented whenever placeholder glyphs of the font are replaced by the refined ones. The
+    /// text laid out with an older generation still shows the placeholders and should be laid out again.
+    [[nodiscard]] uint32_t GetGlyphGeneration(FontHandle handle) const;
+
     /// destroy a font (truetype or baked)
+    /// @remark the atlas regions of its glyphs no other font shares are only reclaimed by CompactAtlas
     void DestroyFont(FontHandle handle);
 
+    /// Reclaim the atlas space of the destroyed fonts, the glyphs of the remaining fonts are moved and
+    /// their region indices updated.
+    /// @return the atlas region remap table (see Atlas::Compact), to fix up the text buffers with
+    ///   TextBufferManager::RemapAtlasRegions, empty if the atlas was not modified
+    std::vector<uint16_t> CompactAtlas();
+
     /// Preload a set of glyphs from a TrueType file.
     ///
     /// @return True if every glyph could be preloaded, false otherwise if
@@ -103,7 +242,32 @@ public:
 
     /// Preload a single glyph, return true on success.
     bool PreloadGlyph(FontHandle handle, CodePoint code_point);
+
+    /// Preload a set of glyphs at once, typically at startup. All the missing glyphs are baked first,
+    /// in parallel for the fonts rasterized by stb_truetype, then added to the atlas from the tallest
+    /// to the shortest, which packs denser than the string order, and uploaded with one texture update
+    /// per atlas face.
+    ///
+    /// @return True if every glyph could be preloaded, false otherwise. A glyph that couldn't be baked or
+    ///   didn't fit in the atlas is not cached, the others are.
+    bool PreloadGlyphs(FontHandle handle, const CodePoint *code_points, uint32_t count);
+
+    bool PreloadGlyphs(FontHandle handle, const wchar_t *string);
     
+    /// Queue glyphs to be baked by Pump instead of right away, the glyphs already in the atlas are skipped.
+    void QueueGlyphs(FontHandle handle, const CodePoint *code_points, uint32_t count, GlyphPriority::Enum priority = GlyphPriority::Prefetch);
+
+    void QueueGlyphs(FontHandle handle, const wchar_t *string, GlyphPriority::Enum priority = GlyphPriority::Prefetch);
+
+    /// Bake the queued glyphs, most urgent first, until the time budget is spent and upload them with one
+    /// texture update per atlas face. Meant to be called once per frame. The bake time of each font type is
+    /// tracked, so a glyph that would not fit in the remaining budget waits for the next call.
+    /// The placeholders of the progressive fonts are refined with what is left of the budget once every
+    /// queued glyph is baked.
+    /// @remark at least one glyph is baked per call, even one that takes longer than the budget
+    GlyphBakeProgress Pump(uint32_t time_budget_us);
+
+    /// Bake a glyph into output without adding it to the atlas, return false if it couldn't be baked.
     bool GenerateGlyph(FontHandle font_handle, CodePoint code_point, uint8_t* output, AtlasRegion::Type& bitmap_type, GlyphInfo &info);
 
     /// Return the font descriptor of a font.
@@ -118,14 +282,44 @@ public:
 
     float GetKerning(FontHandle handle, CodePoint prev_code_point, CodePoint code_point);
 
-    [[nodiscard]] const GlyphInfo &GetBlackGlyph() const {
-        return black_glyph_;
-    }
+    /// Measure an utf-8 string as if it was appended to an empty text buffer, only advances,
+    /// kerning and line metrics are evaluated and no vertices are generated.
+    ///
+    /// @param use_cache reuse the result of a previous measurement of the same string with the same font
+    TextRectangle MeasureText(FontHandle handle, const char *string, const char *end = nullptr, bool use_cache = false);
+
+    /// Measure a wide char unicode string, same as the utf-8 version but without the cache.
+    TextRectangle MeasureText(FontHandle handle, const wchar_t *string, const wchar_t *end = nullptr);
+
+    /// Drop all the cached measurements of a font.
+    void ClearMeasureCache(FontHandle handle);
+
+    /// Return a solid glyph used to draw backgrounds, it is added to the atlas on first use.
+    const GlyphInfo &GetBlackGlyph();
 
 private:
     void Init();
     bool AddBitmap(GlyphInfo &glyph_info, const uint8_t *data, AtlasRegion::Type bitmap_type);
+    static void BakeGlyphs(TrueTypeFont *font, FontType font_type, const CodePoint *code_points, uint32_t count, BakedGlyph *baked_glyphs);
+    static void ScaleGlyph(GlyphInfo &glyph_info, float scale);
     bool FontTypeNeedsMsdfGeneration(FontType font_type);
+    static const GlyphInfo *FindCachedGlyph(const CachedFont &font, CodePoint code_point);
+    static void CacheGlyph(CachedFont &font, CodePoint code_point, const GlyphInfo &glyph_info);
+    static void ClearCachedGlyphs(CachedFont &font);
+    /// @return false if the placeholder couldn't be baked or added to the atlas, nothing is cached then
+    bool AddPlaceholderGlyph(FontHandle handle, CodePoint code_point);
+    /// @return false if the glyph couldn't be baked or added to the atlas, the placeholder is kept then
+    bool RefineGlyph(FontHandle handle, CodePoint code_point);
+    static GlyphKey MakeGlyphKey(const CachedFont &font, int32_t glyph_index);
+    /// copy a glyph another font (or code point) already added to the atlas and take a reference to its region
+    bool AcquireSharedGlyph(const CachedFont &font, int32_t glyph_index, GlyphInfo &out_glyph_info);
+    /// make a glyph just added to the atlas available to the other fonts, holding the first reference to it
+    void ShareGlyph(const CachedFont &font, const GlyphInfo &glyph_info);
+    /// drop a reference to the region of a glyph, the region is removed from the atlas with the last one
+    void ReleaseSharedGlyph(const CachedFont &font, const GlyphInfo &glyph_info);
+    void MeasureGlyph(FontHandle handle, CodePoint code_point, MeasureState &state);
+    /// the metrics of a glyph as GetGlyphInfo would return them, without baking the glyph
+    bool GetGlyphMetrics(FontHandle handle, CodePoint code_point, GlyphInfo &out_glyph_info);
     
     FT_Library ft_library_{};
 
@@ -137,16 +331,30 @@ private:
 
     bx::HandleAllocT<MAX_OPENED_FILES> files_handles_;
     CachedFile *cached_files_{};
+    uint32_t next_file_id_ = 0;
+
+    std::unordered_map<GlyphKey, SharedGlyph, GlyphKeyHash> shared_glyphs_;
     
     bx::HandleAllocT<MAX_OPENED_FACES> face_handles_;
-    FT_Face *cached_faces_{};
+    CachedFace *cached_faces_{};
     
     bx::HandleAllocT<MAX_OPENED_MSDF_GEN> msdf_gen_handles_;
     MsdfGenerator *cached_msdf_generators_{};
-    
-    MsdfOriginalGenerator* msdf_original_generator_;
+
+    struct QueuedGlyph {
+        FontHandle font_handle;
+        CodePoint code_point;
+    };
+    std::deque<QueuedGlyph> glyph_queues_[GlyphPriority::Count];
+    // placeholders of progressive fonts in the order they were added
+    std::deque<QueuedGlyph> refine_queue_;
+    uint32_t queued_glyph_total_ = 0;
+    uint32_t queued_glyph_completed_ = 0;
+    // running average of the time it takes to bake a glyph of every font type, in microseconds
+    float bake_time_estimates_us_[(int) FontType::Color + 1]{};
 
     GlyphInfo black_glyph_{};
+    bool has_black_glyph_ = false;
 
     //temporary buffer to raster glyph
     uint8_t *buffer_{};
@@ -0,0 +1,121 @@
+﻿#include <cwchar>
+
+#include "GlyphSnapshot.h"
+#include "../font_processing/utf8.h"
+
+GlyphSnapshot::GlyphSnapshot(FontManager *font_manager) : font_manager_(font_manager), fonts_(MAX_OPENED_FONT) {}
+
+void GlyphSnapshot::AddText(FontHandle handle, const char *string, const char *end) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    AddFont(handle);
+
+    uint32_t code_point = 0;
+    uint32_t state = UTF8_ACCEPT;
+    uint32_t code_points[256];
+    uint32_t count;
+    do {
+        count = Utf8DecodeBatch(&state, &code_point, &string, end, code_points, BX_COUNTOF(code_points));
+        for (uint32_t ii = 0; ii < count; ++ii) {
+            AddGlyph(handle, (CodePoint) code_points[ii]);
+        }
+    } while (count == BX_COUNTOF(code_points));
+}
+
+void GlyphSnapshot::AddText(FontHandle handle, const wchar_t *string, const wchar_t *end) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    AddFont(handle);
+
+    if (end == nullptr) {
+        end = string + wcslen(string);
+    }
+
+    for (const wchar_t *current = string; current < end; ++current) {
+        AddGlyph(handle, (CodePoint) *current);
+    }
+}
+
+void GlyphSnapshot::AddBackgroundGlyph() {
+    if (!has_black_glyph_) {
+        black_glyph_ = font_manager_->GetBlackGlyph();
+        has_black_glyph_ = true;
+    }
+}
+
+void GlyphSnapshot::Clear() {
+    glyphs_.clear();
+    for (auto &font: fonts_) {
+        font.is_valid = false;
+    }
+    has_black_glyph_ = false;
+}
+
+const GlyphInfo *GlyphSnapshot::GetGlyphInfo(FontHandle handle, CodePoint code_point) const {
+    auto it = glyphs_.find(GlyphKey(handle, code_point));
+    return it != glyphs_.end() ? &it->second.glyph_info : nullptr;
+}
+
+const FontInfo &GlyphSnapshot::GetFontInfo(FontHandle handle) const {
+    BX_ASSERT(fonts_[handle.idx].is_valid, "Font was not added to the snapshot")
+    return fonts_[handle.idx].font_info;
+}
+
+float GlyphSnapshot::GetKerning(FontHandle handle, CodePoint prev_code_point, CodePoint code_point) const {
+    const SnapshotFont &font = fonts_[handle.idx];
+    if (font.kerning_font == nullptr || prev_code_point == 0) {
+        return 0.0f;
+    }
+
+    auto prev = glyphs_.find(GlyphKey(handle, prev_code_point));
+    auto current = glyphs_.find(GlyphKey(handle, code_point));
+    if (prev == glyphs_.end() || current == glyphs_.end()) {
+        return 0.0f;
+    }
+
+    return font.kerning_font->GetGlyphKerning(prev->second.glyph_index, current->second.glyph_index) * font.kerning_scale;
+}
+
+void GlyphSnapshot::AddFont(FontHandle handle) {
+    SnapshotFont &font = fonts_[handle.idx];
+    if (font.is_valid) {
+        return;
+    }
+
+    // same master font resolution as FontManager::GetKerning
+    const FontManager::CachedFont &cached_font = font_manager_->cached_fonts_[handle.idx];
+    if (isValid(cached_font.master_font_handle)) {
+        font.kerning_font = font_manager_->cached_fonts_[cached_font.master_font_handle.idx].true_type_font;
+        font.kerning_scale = cached_font.font_info.scale;
+    } else {
+        font.kerning_font = cached_font.true_type_font;
+        font.kerning_scale = 1.0f;
+    }
+
+    font.font_info = cached_font.font_info;
+    font.is_valid = true;
+}
+
+void GlyphSnapshot::AddGlyph(FontHandle handle, CodePoint code_point) {
+    // tabs are laid out as spaces
+    if (code_point == L'\t') {
+        code_point = L' ';
+    }
+
+    const uint64_t key = GlyphKey(handle, code_point);
+    if (glyphs_.find(key) != glyphs_.end()) {
+        return;
+    }
+
+    const GlyphInfo *glyph_info = font_manager_->GetGlyphInfo(handle, code_point);
+    if (glyph_info == nullptr) {
+        return;
+    }
+
+    SnapshotGlyph glyph{};
+    glyph.glyph_info = *glyph_info;
+
+    // the glyph index is resolved here, so the kerning can be read later without touching the font
+    TrueTypeFont *kerning_font = fonts_[handle.idx].kerning_font;
+    glyph.glyph_index = kerning_font != nullptr ? kerning_font->GetGlyphIndex(code_point) : 0;
+
+    glyphs_.emplace(key, glyph);
+}
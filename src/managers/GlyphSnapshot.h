@@ -0,0 +1,73 @@
+﻿#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "FontManager.h"
+
+// GlyphSnapshot is an immutable view of the glyphs needed to lay out a frame.
+// It is built in two phases:
+//  1. on the thread owning the FontManager, AddText resolves (and bakes if needed) every glyph
+//  2. any number of threads lay out text buffers against the snapshot, which only reads from it
+// The font manager and its atlas must not be modified while the snapshot is being read.
+class GlyphSnapshot {
+public:
+    /// @remark the ownership of the manager is not taken
+    explicit GlyphSnapshot(FontManager *font_manager);
+
+    /// resolve all the glyphs of an utf-8 string
+    void AddText(FontHandle handle, const char *string, const char *end = nullptr);
+
+    /// resolve all the glyphs of a wide char unicode string
+    void AddText(FontHandle handle, const wchar_t *string, const wchar_t *end = nullptr);
+
+    /// resolve the solid glyph used for STYLE_BACKGROUND
+    void AddBackgroundGlyph();
+
+    /// drop all the resolved glyphs, so the snapshot can be reused for the next frame
+    void Clear();
+
+    /// @return nullptr if the glyph was not added to the snapshot
+    [[nodiscard]] const GlyphInfo *GetGlyphInfo(FontHandle handle, CodePoint code_point) const;
+
+    [[nodiscard]] const FontInfo &GetFontInfo(FontHandle handle) const;
+
+    [[nodiscard]] float GetKerning(FontHandle handle, CodePoint prev_code_point, CodePoint code_point) const;
+
+    /// @return nullptr if AddBackgroundGlyph was not called
+    [[nodiscard]] const GlyphInfo *GetBlackGlyph() const {
+        return has_black_glyph_ ? &black_glyph_ : nullptr;
+    }
+
+    [[nodiscard]] const Atlas *GetAtlas() const {
+        return font_manager_->GetAtlas();
+    }
+
+private:
+    struct SnapshotGlyph {
+        GlyphInfo glyph_info;
+        int32_t glyph_index;
+    };
+
+    struct SnapshotFont {
+        FontInfo font_info;
+        // font used for the kerning, the master font in case of a scaled font
+        TrueTypeFont *kerning_font;
+        float kerning_scale;
+        bool is_valid;
+    };
+
+    void AddFont(FontHandle handle);
+    void AddGlyph(FontHandle handle, CodePoint code_point);
+
+    static uint64_t GlyphKey(FontHandle handle, CodePoint code_point) {
+        return ((uint64_t) handle.idx << 32) | (uint32_t) code_point;
+    }
+
+    FontManager *font_manager_;
+    std::vector<SnapshotFont> fonts_;
+    std::unordered_map<uint64_t, SnapshotGlyph> glyphs_;
+
+    GlyphInfo black_glyph_{};
+    bool has_black_glyph_ = false;
+};
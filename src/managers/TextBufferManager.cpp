@@ -8,6 +8,7 @@
  */
 
 #include <bgfx/embedded_shader.h>
+#include <bx/math.h>
 
 #include "TextBufferManager.h"
 #include "../font_processing/CubeAtlas.h"
@@ -18,6 +19,10 @@
 #include "../shaders/fragment/fs_font_sdf.bin.h"
 #include "../shaders/fragment/fs_font_msdf.bin.h"
 #include "../shaders/fragment/fs_color.bin.h"
+#include "../shaders/fragment/fs_font_basic_array.bin.h"
+#include "../shaders/fragment/fs_font_sdf_array.bin.h"
+#include "../shaders/fragment/fs_font_msdf_array.bin.h"
+#include "../shaders/fragment/fs_color_array.bin.h"
 
 static const bgfx::EmbeddedShader s_embedded_shaders_[] =
         {
@@ -26,6 +31,10 @@ static const bgfx::EmbeddedShader s_embedded_shaders_[] =
                 BGFX_EMBEDDED_SHADER(fs_font_sdf),
                 BGFX_EMBEDDED_SHADER(fs_font_msdf),
                 BGFX_EMBEDDED_SHADER(fs_color),
+                BGFX_EMBEDDED_SHADER(fs_font_basic_array),
+                BGFX_EMBEDDED_SHADER(fs_font_sdf_array),
+                BGFX_EMBEDDED_SHADER(fs_font_msdf_array),
+                BGFX_EMBEDDED_SHADER(fs_color_array),
                 BGFX_EMBEDDED_SHADER_END()
         };
 
@@ -55,6 +64,29 @@ TextBufferManager::TextBufferManager(FontManager *font_manager) : font_manager_(
             bgfx::createEmbeddedShader(s_embedded_shaders_, type, "fs_color"), true
     );
 
+    // same vertex shader, the fragment shaders sample a 2D texture array instead of a cube
+    if (font_manager_->GetAtlas()->GetTextureType() == AtlasTextureType::Array) {
+        basic_array_program_ = bgfx::createProgram(
+                bgfx::createEmbeddedShader(s_embedded_shaders_, type, "vs_font_basic"),
+                bgfx::createEmbeddedShader(s_embedded_shaders_, type, "fs_font_basic_array"), true
+        );
+
+        sdf_array_program_ = bgfx::createProgram(
+                bgfx::createEmbeddedShader(s_embedded_shaders_, type, "vs_font_basic"),
+                bgfx::createEmbeddedShader(s_embedded_shaders_, type, "fs_font_sdf_array"), true
+        );
+
+        msdf_array_program_ = bgfx::createProgram(
+                bgfx::createEmbeddedShader(s_embedded_shaders_, type, "vs_font_basic"),
+                bgfx::createEmbeddedShader(s_embedded_shaders_, type, "fs_font_msdf_array"), true
+        );
+
+        color_array_program_ = bgfx::createProgram(
+                bgfx::createEmbeddedShader(s_embedded_shaders_, type, "vs_font_basic"),
+                bgfx::createEmbeddedShader(s_embedded_shaders_, type, "fs_color_array"), true
+        );
+    }
+
     vertex_layout_
             .begin()
             .add(bgfx::Attrib::Position, 2, bgfx::AttribType::Float)
@@ -79,6 +111,13 @@ TextBufferManager::~TextBufferManager() {
     bgfx::destroy(sdf_program_);
     bgfx::destroy(msdf_program_);
     bgfx::destroy(color_program_);
+
+    if (isValid(basic_array_program_)) {
+        bgfx::destroy(basic_array_program_);
+        bgfx::destroy(sdf_array_program_);
+        bgfx::destroy(msdf_array_program_);
+        bgfx::destroy(color_array_program_);
+    }
 }
 
 TextBufferHandle TextBufferManager::CreateTextBuffer(FontType type, BufferType::Enum buffer_type) {
@@ -90,6 +129,12 @@ TextBufferHandle TextBufferManager::CreateTextBuffer(FontType type, BufferType::
     bc.buffer_type = buffer_type;
     bc.index_buffer_handle_idx = bgfx::kInvalidHandle;
     bc.vertex_buffer_handle_idx = bgfx::kInvalidHandle;
+    bc.dirty = true;
+    bc.has_scissor = false;
+    bc.direct_layout = false;
+    bc.reserved_glyph_count = 0;
+    bc.transient_draws.clear();
+    bc.glyph_generations.clear();
 
     TextBufferHandle ret = {text_idx};
     return ret;
@@ -102,6 +147,9 @@ void TextBufferManager::DestroyTextBuffer(TextBufferHandle handle) {
     text_buffer_handles_.free(handle.idx);
     delete bc.text_buffer;
     bc.text_buffer = nullptr;
+    bc.transient_draws.clear();
+    bc.glyph_generations.clear();
+    bc.direct_layout = false;
 
     if (bc.vertex_buffer_handle_idx == bgfx::kInvalidHandle) {
         return;
@@ -134,48 +182,59 @@ void TextBufferManager::DestroyTextBuffer(TextBufferHandle handle) {
 }
 
 void TextBufferManager::SubmitTextBuffer(TextBufferHandle handle, bgfx::ViewId id, int32_t depth) {
-    BX_ASSERT(isValid(handle), "Invalid handle used")
+    Submit(handle, id, depth, nullptr);
+}
 
-    BufferCache &bc = text_buffers_[handle.idx];
+void TextBufferManager::SubmitTextBuffer(TextBufferHandle handle, bgfx::ViewId id, const TextTransform &transform, int32_t depth) {
+    float mtx[16];
+    GetTransformMatrix(transform, mtx);
+    Submit(handle, id, depth, mtx);
+}
 
-    uint32_t index_size = bc.text_buffer->GetIndexCount() * TextBuffer::GetIndexSize();
-    uint32_t vertex_size = bc.text_buffer->GetVertexCount() * TextBuffer::GetVertexSize();
+void TextBufferManager::GetTransformMatrix(const TextTransform &transform, float *out_matrix) {
+    bx::mtxSRT(out_matrix, transform.scale_x, transform.scale_y, 1.0f, 0.0f, 0.0f, transform.rotation, transform.x, transform.y, 0.0f);
+}
 
-    if (0 == index_size || 0 == vertex_size) {
-        return;
-    }
+void TextBufferManager::Submit(TextBufferHandle handle, bgfx::ViewId id, int32_t depth, const float *transform) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
 
-    bgfx::setTexture(0, tex_color_, font_manager_->GetAtlas()->GetTextureHandle());
+    BufferCache &bc = text_buffers_[handle.idx];
 
     bgfx::ProgramHandle program = BGFX_INVALID_HANDLE;
+    const bool is_array = font_manager_->GetAtlas()->GetTextureType() == AtlasTextureType::Array;
     // Load the correct shader program based on the font type
     switch (bc.font_type) {
         case FontType::Bitmap:
-            program = basic_program_;
-            bgfx::setState(0 | BGFX_STATE_WRITE_RGB | BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA));
+            program = is_array ? basic_array_program_ : basic_program_;
             break;
         case FontType::SdfFromVector:
-        case FontType::SdfFromBitmap: {
-            program = sdf_program_;
-            bgfx::setState(0 | BGFX_STATE_WRITE_RGB | BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA));
+        case FontType::SdfFromBitmap:
+            program = is_array ? sdf_array_program_ : sdf_program_;
             break;
-        }
         case FontType::MsdfOriginal:
-        case FontType::Msdf: {
-            program = msdf_program_;
-            bgfx::setState(0 | BGFX_STATE_WRITE_RGB | BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA));
+        case FontType::Msdf:
+            program = is_array ? msdf_array_program_ : msdf_program_;
             break;
-        }
-        case FontType::Color: {
-            program = color_program_;
-            bgfx::setState(0 | BGFX_STATE_WRITE_RGB | BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA));
+        case FontType::Color:
+            program = is_array ? color_array_program_ : color_program_;
             break;
-        }
         default: 
             BX_ASSERT(false, "Shader for font type %d not found", bc.font_type)
             break;
     }
 
+    if (bc.direct_layout) {
+        SubmitTransientDraws(bc, id, program, depth, transform);
+        return;
+    }
+
+    uint32_t index_size = bc.text_buffer->GetIndexCount() * TextBuffer::GetIndexSize();
+    uint32_t vertex_size = bc.text_buffer->GetVertexCount() * TextBuffer::GetVertexSize();
+
+    if (0 == index_size || 0 == vertex_size) {
+        return;
+    }
+
     switch (bc.buffer_type) {
         case BufferType::Static: {
             bgfx::IndexBufferHandle ibh {};
@@ -211,9 +270,13 @@ void TextBufferManager::SubmitTextBuffer(TextBufferHandle handle, bgfx::ViewId i
                 ibh.idx = bc.index_buffer_handle_idx;
                 vbh.idx = bc.vertex_buffer_handle_idx;
 
-                bgfx::update(ibh, 0, bgfx::copy(bc.text_buffer->GetIndexBuffer(), index_size));
-                bgfx::update(vbh, 0, bgfx::copy(bc.text_buffer->GetVertexBuffer(), vertex_size));
+                // only upload again if the text changed, moving the buffer with a transform keeps the data
+                if (bc.dirty) {
+                    bgfx::update(ibh, 0, bgfx::copy(bc.text_buffer->GetIndexBuffer(), index_size));
+                    bgfx::update(vbh, 0, bgfx::copy(bc.text_buffer->GetVertexBuffer(), vertex_size));
+                }
             }
+            bc.dirty = false;
 
             bgfx::setVertexBuffer(0, vbh, 0, bc.text_buffer->GetVertexCount());
             bgfx::setIndexBuffer(ibh, 0, bc.text_buffer->GetIndexCount());
@@ -233,19 +296,211 @@ void TextBufferManager::SubmitTextBuffer(TextBufferHandle handle, bgfx::ViewId i
             break;
     }
 
+    SetRenderState(bc, transform);
     bgfx::submit(id, program, depth);
 }
 
+void TextBufferManager::SubmitTransientDraws(BufferCache &bc, bgfx::ViewId id, bgfx::ProgramHandle program, int32_t depth, const float *transform) {
+    // the last draw is the storage the text buffer is currently writing to
+    if (!bc.transient_draws.empty()) {
+        TransientDraw &draw = bc.transient_draws.back();
+        draw.vertex_count = bc.text_buffer->GetVertexCount();
+        draw.index_count = bc.text_buffer->GetIndexCount();
+    }
+
+    // the vertices are already in transient memory, every filled storage is one draw call
+    for (const TransientDraw &draw: bc.transient_draws) {
+        if (draw.index_count == 0) {
+            continue;
+        }
+
+        bgfx::setVertexBuffer(0, &draw.vertex_buffer, 0, draw.vertex_count);
+        bgfx::setIndexBuffer(&draw.index_buffer, 0, draw.index_count);
+        SetRenderState(bc, transform);
+        bgfx::submit(id, program, depth);
+    }
+
+    // the transient memory is only valid for this frame
+    bc.transient_draws.clear();
+    bc.direct_layout = false;
+    bc.text_buffer->SetStorageFullCallback(nullptr);
+    bc.text_buffer->ResetStorage();
+}
+
+void TextBufferManager::SetRenderState(const BufferCache &bc, const float *transform) {
+    bgfx::setTexture(0, tex_color_, font_manager_->GetAtlas()->GetTextureHandle());
+    bgfx::setState(0 | BGFX_STATE_WRITE_RGB | BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA));
+
+    if (transform != nullptr) {
+        bgfx::setTransform(transform);
+    }
+
+    TextClipRectangle scissor;
+    if (GetScissor(bc, transform, scissor)) {
+        bgfx::setScissor((uint16_t) scissor.x, (uint16_t) scissor.y, (uint16_t) scissor.width, (uint16_t) scissor.height);
+    }
+}
+
+void TextBufferManager::BeginTransientLayout(TextBufferHandle handle, uint32_t glyph_count) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BufferCache &bc = text_buffers_[handle.idx];
+    BX_ASSERT(bc.buffer_type == BufferType::Transient, "Only transient buffers can be laid out in transient memory")
+
+    bc.text_buffer->ClearTextBuffer();
+    bc.transient_draws.clear();
+    bc.direct_layout = true;
+    bc.reserved_glyph_count = glyph_count;
+    bc.text_buffer->SetStorageFullCallback([this, &bc] { AllocateTransientStorage(bc); });
+
+    if (glyph_count > 0) {
+        AllocateTransientStorage(bc);
+    } else {
+        // the first glyph allocates the storage
+        bc.text_buffer->SetStorage(nullptr, nullptr, 0);
+    }
+}
+
+void TextBufferManager::AllocateTransientStorage(BufferCache &bc) {
+    // close the draw of the full storage, its indices are relative to its own vertices
+    if (!bc.transient_draws.empty()) {
+        TransientDraw &draw = bc.transient_draws.back();
+        draw.vertex_count = bc.text_buffer->GetVertexCount();
+        draw.index_count = bc.text_buffer->GetIndexCount();
+    }
+
+    uint32_t glyph_count = bx::max(bc.reserved_glyph_count, (uint32_t) MIN_TRANSIENT_GLYPH_COUNT);
+    glyph_count = bx::min(glyph_count, TextBuffer::GetMaxQuadCount());
+    glyph_count = bx::min(glyph_count, bgfx::getAvailTransientVertexBuffer(glyph_count * 4, vertex_layout_) / 4);
+    glyph_count = bx::min(glyph_count, bgfx::getAvailTransientIndexBuffer(glyph_count * 6) / 6);
+
+    BX_WARN(glyph_count > 0, "Out of transient memory, the remaining glyphs are dropped")
+    if (glyph_count == 0) {
+        return;
+    }
+
+    TransientDraw draw{};
+    bgfx::allocTransientVertexBuffer(&draw.vertex_buffer, glyph_count * 4, vertex_layout_);
+    bgfx::allocTransientIndexBuffer(&draw.index_buffer, glyph_count * 6);
+    bc.transient_draws.push_back(draw);
+    bc.reserved_glyph_count -= bx::min(bc.reserved_glyph_count, glyph_count);
+
+    bc.text_buffer->SetStorage(draw.vertex_buffer.data, (uint16_t *) draw.index_buffer.data, glyph_count);
+}
+
+bool TextBufferManager::GetScissor(TextBufferHandle handle, const TextTransform &transform, TextClipRectangle &out_scissor) const {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    float mtx[16];
+    GetTransformMatrix(transform, mtx);
+    return GetScissor(text_buffers_[handle.idx], mtx, out_scissor);
+}
+
+bool TextBufferManager::GetScissor(const BufferCache &bc, const float *transform, TextClipRectangle &out_scissor) {
+    if (!bc.text_buffer->HasClipRectangle() && !bc.has_scissor) {
+        return false;
+    }
+
+    float min_x = -bx::kFloatInfinity, min_y = -bx::kFloatInfinity;
+    float max_x = bx::kFloatInfinity, max_y = bx::kFloatInfinity;
+
+    if (bc.text_buffer->HasClipRectangle()) {
+        const TextClipRectangle &clip = bc.text_buffer->GetClipRectangle();
+        min_x = clip.x;
+        min_y = clip.y;
+        max_x = clip.x + clip.width;
+        max_y = clip.y + clip.height;
+
+        // the scissor is axis aligned, so use the bounds of the transformed clip rectangle
+        if (transform != nullptr) {
+            const float corners[4][2] = {{min_x, min_y}, {max_x, min_y}, {min_x, max_y}, {max_x, max_y}};
+            min_x = min_y = bx::kFloatInfinity;
+            max_x = max_y = -bx::kFloatInfinity;
+            for (const auto &corner: corners) {
+                const float x = transform[0] * corner[0] + transform[4] * corner[1] + transform[12];
+                const float y = transform[1] * corner[0] + transform[5] * corner[1] + transform[13];
+                min_x = bx::min(min_x, x);
+                min_y = bx::min(min_y, y);
+                max_x = bx::max(max_x, x);
+                max_y = bx::max(max_y, y);
+            }
+        }
+    }
+
+    if (bc.has_scissor) {
+        min_x = bx::max(min_x, bc.scissor.x);
+        min_y = bx::max(min_y, bc.scissor.y);
+        max_x = bx::min(max_x, bc.scissor.x + bc.scissor.width);
+        max_y = bx::min(max_y, bc.scissor.y + bc.scissor.height);
+    }
+
+    const float x0 = bx::clamp(bx::floor(min_x), 0.0f, float(UINT16_MAX));
+    const float y0 = bx::clamp(bx::floor(min_y), 0.0f, float(UINT16_MAX));
+    const float x1 = bx::clamp(bx::ceil(max_x), x0, float(UINT16_MAX));
+    const float y1 = bx::clamp(bx::ceil(max_y), y0, float(UINT16_MAX));
+    out_scissor = {x0, y0, x1 - x0, y1 - y0};
+    return true;
+}
+
 void TextBufferManager::SetPenPosition(TextBufferHandle handle, float x, float y) {
     BX_ASSERT(isValid(handle), "Invalid handle used")
     BufferCache &bc = text_buffers_[handle.idx];
     bc.text_buffer->SetPenPosition(x, y);
 }
 
+void TextBufferManager::SetClipRectangle(TextBufferHandle handle, float x, float y, float width, float height) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BufferCache &bc = text_buffers_[handle.idx];
+    bc.text_buffer->SetClipRectangle(x, y, width, height);
+}
+
+void TextBufferManager::ClearClipRectangle(TextBufferHandle handle) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BufferCache &bc = text_buffers_[handle.idx];
+    bc.text_buffer->ClearClipRectangle();
+}
+
+void TextBufferManager::SetScissor(TextBufferHandle handle, float x, float y, float width, float height) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BufferCache &bc = text_buffers_[handle.idx];
+    bc.scissor = {x, y, width, height};
+    bc.has_scissor = true;
+}
+
+void TextBufferManager::ClearScissor(TextBufferHandle handle) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BufferCache &bc = text_buffers_[handle.idx];
+    bc.has_scissor = false;
+}
+
+void TextBufferManager::SetStyle(TextBufferHandle handle, uint32_t flags) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BufferCache &bc = text_buffers_[handle.idx];
+    bc.text_buffer->SetStyle(flags);
+}
+
+void TextBufferManager::SetTextColor(TextBufferHandle handle, uint32_t rgba) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BufferCache &bc = text_buffers_[handle.idx];
+    bc.text_buffer->SetTextColor(rgba);
+}
+
+void TextBufferManager::SetOutlineColor(TextBufferHandle handle, uint32_t rgba) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BufferCache &bc = text_buffers_[handle.idx];
+    bc.text_buffer->SetOutlineColor(rgba);
+}
+
+void TextBufferManager::SetBackgroundColor(TextBufferHandle handle, uint32_t rgba) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BufferCache &bc = text_buffers_[handle.idx];
+    bc.text_buffer->SetBackgroundColor(rgba);
+}
+
 void TextBufferManager::AppendText(TextBufferHandle handle, FontHandle font_handle, const char *string, const char *end) {
     BX_ASSERT(isValid(handle), "Invalid handle used")
     BufferCache &bc = text_buffers_[handle.idx];
     bc.text_buffer->AppendText(font_handle, string, end);
+    bc.dirty = true;
+    RecordGlyphGeneration(bc, font_handle);
 }
 
 void TextBufferManager::AppendText(TextBufferHandle handle, FontHandle font_handle, const wchar_t *string,
@@ -253,18 +508,86 @@ void TextBufferManager::AppendText(TextBufferHandle handle, FontHandle font_hand
     BX_ASSERT(isValid(handle), "Invalid handle used")
     BufferCache &bc = text_buffers_[handle.idx];
     bc.text_buffer->AppendText(font_handle, string, end);
+    bc.dirty = true;
+    RecordGlyphGeneration(bc, font_handle);
+}
+
+void TextBufferManager::AppendText(TextBufferHandle handle, const GlyphSnapshot &snapshot, FontHandle font_handle,
+                                   const char *string, const char *end) {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    BufferCache &bc = text_buffers_[handle.idx];
+    bc.text_buffer->AppendText(snapshot, font_handle, string, end);
+    bc.dirty = true;
+    RecordGlyphGeneration(bc, font_handle);
 }
 
 void TextBufferManager::AppendAtlasFace(TextBufferHandle handle, uint16_t face_index) {
     BX_ASSERT(isValid(handle), "Invalid handle used")
     BufferCache &bc = text_buffers_[handle.idx];
     bc.text_buffer->AppendAtlasFace(face_index);
+    bc.dirty = true;
+}
+
+bool TextBufferManager::IsLayoutStale(TextBufferHandle handle) const {
+    BX_ASSERT(isValid(handle), "Invalid handle used")
+    const BufferCache &bc = text_buffers_[handle.idx];
+    for (const auto &[font_idx, generation]: bc.glyph_generations) {
+        if (font_manager_->GetGlyphGeneration({font_idx}) != generation) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TextBufferManager::RecordGlyphGeneration(BufferCache &bc, FontHandle font_handle) const {
+    for (const auto &glyph_generation: bc.glyph_generations) {
+        if (glyph_generation.first == font_handle.idx) {
+            return;
+        }
+    }
+    bc.glyph_generations.emplace_back(font_handle.idx, font_manager_->GetGlyphGeneration(font_handle));
 }
 
 void TextBufferManager::ClearTextBuffer(TextBufferHandle handle) {
     BX_ASSERT(isValid(handle), "Invalid handle used")
     BufferCache &bc = text_buffers_[handle.idx];
     bc.text_buffer->ClearTextBuffer();
+    bc.dirty = true;
+    bc.glyph_generations.clear();
+
+    // the layout restarts in the current storage, the previous draws are dropped
+    if (bc.direct_layout && bc.transient_draws.size() > 1) {
+        bc.transient_draws.erase(bc.transient_draws.begin(), bc.transient_draws.end() - 1);
+    }
+}
+
+void TextBufferManager::RemapAtlasRegions(const std::vector<uint16_t> &remap) {
+    if (remap.empty()) {
+        return;
+    }
+
+    for (uint16_t ii = 0; ii < text_buffer_handles_.getNumHandles(); ++ii) {
+        BufferCache &bc = text_buffers_[text_buffer_handles_.getHandleAt(ii)];
+        if (bc.buffer_type == BufferType::Transient) {
+            continue;
+        }
+
+        bc.text_buffer->RemapAtlasRegions(remap);
+        bc.dirty = true;
+
+        // a static buffer can't be updated, it is created again on the next submit
+        if (bc.buffer_type == BufferType::Static && bc.vertex_buffer_handle_idx != bgfx::kInvalidHandle) {
+            bgfx::IndexBufferHandle ibh {};
+            bgfx::VertexBufferHandle vbh {};
+            ibh.idx = bc.index_buffer_handle_idx;
+            vbh.idx = bc.vertex_buffer_handle_idx;
+            bgfx::destroy(ibh);
+            bgfx::destroy(vbh);
+
+            bc.index_buffer_handle_idx = bgfx::kInvalidHandle;
+            bc.vertex_buffer_handle_idx = bgfx::kInvalidHandle;
+        }
+    }
 }
 
 TextRectangle TextBufferManager::GetRectangle(TextBufferHandle handle) const {
@@ -273,3 +596,7 @@ TextRectangle TextBufferManager::GetRectangle(TextBufferHandle handle) const {
     return bc.text_buffer->GetRectangle();
 }
 
+TextRectangle TextBufferManager::MeasureText(FontHandle font_handle, const char *string, const char *end, bool use_cache) const {
+    return font_manager_->MeasureText(font_handle, string, end, use_cache);
+}
+
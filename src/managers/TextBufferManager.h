@@ -8,13 +8,28 @@
  */
 #pragma once
 
+#include <vector>
+
 #include "FontManager.h"
+#include "GlyphSnapshot.h"
 #include "../font_processing/TextBuffer.h"
 #include "../font_processing/FontInfo.h"
 
 BGFX_HANDLE(TextBufferHandle)
 
 #define MAX_TEXT_BUFFER_COUNT 64
+#define MIN_TRANSIENT_GLYPH_COUNT 256
+
+/// 2D transform applied to a text buffer when it is submitted. The text is laid out in
+/// buffer local space, so moving, scaling or rotating it doesn't require a new layout.
+struct TextTransform {
+    float x = 0.0f;
+    float y = 0.0f;
+    float scale_x = 1.0f;
+    float scale_y = 1.0f;
+    /// rotation around the buffer origin in radians
+    float rotation = 0.0f;
+};
 
 class TextBuffer;
 
@@ -30,8 +45,49 @@ public:
 
     void SubmitTextBuffer(TextBufferHandle handle, bgfx::ViewId id, int32_t depth = 0);
 
+    /// Submit a text buffer with a transform, Static and Dynamic buffers are not uploaded again when only the transform changes.
+    void SubmitTextBuffer(TextBufferHandle handle, bgfx::ViewId id, const TextTransform &transform, int32_t depth = 0);
+
+    /// Lay out the text appended to a Transient buffer until its next submit directly into bgfx transient
+    /// memory, instead of copying it there when it is submitted. Space for glyph_count glyphs is reserved
+    /// up front, the layout continues in another draw call when it is exceeded or when bgfx runs out of
+    /// transient memory for a single allocation.
+    /// @remark the buffer is cleared when it is submitted, so it has to be laid out again every frame
+    void BeginTransientLayout(TextBufferHandle handle, uint32_t glyph_count);
+
     void SetPenPosition(TextBufferHandle handle, float x, float y);
 
+    /// Set a clip rectangle in buffer space, glyphs appended after this call that are completely outside
+    /// of it are not laid out and the buffer is drawn with a scissor around it.
+    /// @remark the scissor assumes that one unit of the view maps to one pixel of the framebuffer
+    void SetClipRectangle(TextBufferHandle handle, float x, float y, float width, float height);
+
+    /// Disable the clip rectangle of a text buffer.
+    void ClearClipRectangle(TextBufferHandle handle);
+
+    /// Set a rectangle in view space the buffer is drawn into, it isn't moved by the transform of the buffer.
+    /// The text is laid out as before, the scissor of the clip rectangle is cut down to it when submitted.
+    void SetScissor(TextBufferHandle handle, float x, float y, float width, float height);
+
+    /// Disable the view space scissor of a text buffer.
+    void ClearScissor(TextBufferHandle handle);
+
+    /// Return the scissor in whole view units SubmitTextBuffer draws the buffer with, from its clip rectangle moved
+    /// by the transform and its view space scissor. False if it is drawn without one.
+    bool GetScissor(TextBufferHandle handle, const TextTransform &transform, TextClipRectangle &out_scissor) const;
+
+    /// Set the style flags (TextStyleFlags) of the text appended after this call.
+    void SetStyle(TextBufferHandle handle, uint32_t flags = STYLE_NORMAL);
+
+    /// Set the color of the text appended after this call.
+    void SetTextColor(TextBufferHandle handle, uint32_t rgba = 0x000000FF);
+
+    /// Set the outline color of the text appended after this call, drawn with STYLE_OUTLINE.
+    void SetOutlineColor(TextBufferHandle handle, uint32_t rgba = 0x000000FF);
+
+    /// Set the background color of the text appended after this call, drawn with STYLE_BACKGROUND.
+    void SetBackgroundColor(TextBufferHandle handle, uint32_t rgba = 0x000000FF);
+
     /// Append an ASCII/utf-8 string to the buffer using current pen position and color.
     void AppendText(TextBufferHandle handle, FontHandle font_handle, const char *string, const char *end = nullptr);
 
@@ -39,22 +95,70 @@ public:
     void
     AppendText(TextBufferHandle handle, FontHandle font_handle, const wchar_t *string, const wchar_t *end = nullptr);
 
+    /// Append an utf-8 string reading the glyphs from a snapshot built beforehand with the same strings.
+    /// Different text buffers can be appended to from different threads at the same time, as long as the
+    /// font manager and its atlas are not modified meanwhile. Creating and destroying buffers is not thread safe.
+    void AppendText(TextBufferHandle handle, const GlyphSnapshot &snapshot, FontHandle font_handle, const char *string,
+                    const char *end = nullptr);
+
     /// Append a whole face of the atlas cube, mostly used for debugging and visualizing atlas.
     void AppendAtlasFace(TextBufferHandle handle, uint16_t face_index);
 
     /// Clear the text buffer and reset its state (pen/color).
     void ClearTextBuffer(TextBufferHandle handle);
 
+    /// Pack the uv coordinates of every Static and Dynamic buffer again after the atlas was compacted,
+    /// they are uploaded again on their next submit. Transient buffers are laid out every frame anyway.
+    /// @param remap the table returned by FontManager::CompactAtlas
+    void RemapAtlasRegions(const std::vector<uint16_t> &remap);
+
+    /// Return true when a progressive font refined some of its glyphs since the text was appended, the text
+    /// still draws the placeholders and has to be cleared and appended again to pick up the refined glyphs.
+    /// @see FontManager::SetProgressive
+    [[nodiscard]] bool IsLayoutStale(TextBufferHandle handle) const;
+
     /// Return the rectangular size of the current text buffer (including all its content).
     [[nodiscard]] TextRectangle GetRectangle(TextBufferHandle handle) const;
 
+    /// Return the rectangular size of a string without appending it to a text buffer.
+    /// @see FontManager::MeasureText
+    [[nodiscard]] TextRectangle MeasureText(FontHandle font_handle, const char *string, const char *end = nullptr, bool use_cache = false) const;
+
 private:
+    struct TransientDraw {
+        bgfx::TransientVertexBuffer vertex_buffer;
+        bgfx::TransientIndexBuffer index_buffer;
+        uint32_t vertex_count;
+        uint32_t index_count;
+    };
+
+    struct BufferCache;
+
+    void Submit(TextBufferHandle handle, bgfx::ViewId id, int32_t depth, const float *transform);
+    void SubmitTransientDraws(BufferCache &bc, bgfx::ViewId id, bgfx::ProgramHandle program, int32_t depth, const float *transform);
+    void SetRenderState(const BufferCache &bc, const float *transform);
+    void AllocateTransientStorage(BufferCache &bc);
+    static bool GetScissor(const BufferCache &bc, const float *transform, TextClipRectangle &out_scissor);
+    static void GetTransformMatrix(const TextTransform &transform, float *out_matrix);
+    void RecordGlyphGeneration(BufferCache &bc, FontHandle font_handle) const;
+
     struct BufferCache {
         uint16_t index_buffer_handle_idx;
         uint16_t vertex_buffer_handle_idx;
         TextBuffer *text_buffer;
         BufferType::Enum buffer_type;
         FontType font_type;
+        // the content changed since the last upload of a dynamic buffer
+        bool dirty;
+        // see SetScissor, in view space
+        TextClipRectangle scissor;
+        bool has_scissor;
+        // BeginTransientLayout was called, the text is written to transient_draws
+        bool direct_layout;
+        uint32_t reserved_glyph_count;
+        std::vector<TransientDraw> transient_draws;
+        // glyph generation of every font appended since the last clear, when it was first appended
+        std::vector<std::pair<uint16_t, uint32_t>> glyph_generations;
     };
 
     BufferCache *text_buffers_;
@@ -66,4 +170,9 @@ private:
     bgfx::ProgramHandle sdf_program_{};
     bgfx::ProgramHandle msdf_program_{};
     bgfx::ProgramHandle color_program_{};
+    // only created for an atlas backed by a texture array
+    bgfx::ProgramHandle basic_array_program_ = BGFX_INVALID_HANDLE;
+    bgfx::ProgramHandle sdf_array_program_ = BGFX_INVALID_HANDLE;
+    bgfx::ProgramHandle msdf_array_program_ = BGFX_INVALID_HANDLE;
+    bgfx::ProgramHandle color_array_program_ = BGFX_INVALID_HANDLE;
 };
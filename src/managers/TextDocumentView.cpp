@@ -0,0 +1,154 @@
+﻿#include <cstring>
+#include <bx/math.h>
+
+#include "TextDocumentView.h"
+
+TextDocumentView::TextDocumentView(TextBufferManager *text_buffer_manager, FontManager *font_manager, FontHandle font_handle, FontType font_type)
+        : text_buffer_manager_(text_buffer_manager), font_handle_(font_handle) {
+    // the vertices are regenerated only when the view changes, but copied every frame
+    text_buffer_ = text_buffer_manager_->CreateTextBuffer(font_type, BufferType::Transient);
+    SetViewport(0.0f, 0.0f, 0.0f, 0.0f);
+
+    const FontInfo &font_info = font_manager->GetFontInfo(font_handle);
+    line_height_ = font_info.ascender - font_info.descender + font_info.line_gap;
+}
+
+TextDocumentView::~TextDocumentView() {
+    text_buffer_manager_->DestroyTextBuffer(text_buffer_);
+}
+
+void TextDocumentView::SetDocument(const char *text, uint32_t size) {
+    text_ = text;
+    text_size_ = size;
+
+    line_offsets_.clear();
+    line_offsets_.push_back(0);
+    IndexLines(0);
+    dirty_ = true;
+}
+
+void TextDocumentView::ExtendDocument(const char *text, uint32_t size) {
+    BX_ASSERT(size >= text_size_, "The document can only grow")
+
+    text_ = text;
+    text_size_ = size;
+
+    if (line_offsets_.empty()) {
+        line_offsets_.push_back(0);
+    }
+    // the last line might have been incomplete, continue indexing from its start
+    IndexLines(line_offsets_.back());
+    dirty_ = true;
+}
+
+void TextDocumentView::SetViewport(float x, float y, float width, float height) {
+    viewport_x_ = x;
+    viewport_y_ = y;
+    viewport_width_ = width;
+    viewport_height_ = height;
+    text_buffer_manager_->SetScissor(text_buffer_, x, y, width, height);
+}
+
+void TextDocumentView::SetScroll(float x, float y) {
+    scroll_x_ = x;
+    scroll_y_ = y;
+}
+
+void TextDocumentView::Submit(bgfx::ViewId id, int32_t depth) {
+    uint32_t first_line, last_line;
+    GetVisibleLineRange(first_line, last_line);
+
+    const float layout_left = GetLayoutLeft();
+
+    // the lines are laid out relative to the first visible one, so scrolling only changes the transform,
+    // a progressive font refining its placeholder glyphs lays them out again
+    if (dirty_ || text_buffer_manager_->IsLayoutStale(text_buffer_) || first_line != first_visible_line_ || last_line != last_visible_line_
+        || layout_left != layout_left_) {
+        LayoutLines(first_line, last_line, layout_left);
+        dirty_ = false;
+    }
+
+    text_buffer_manager_->SubmitTextBuffer(text_buffer_, id, GetTransform(), depth);
+}
+
+TextClipRectangle TextDocumentView::GetScissor() const {
+    // the scissor is set by the constructor, so there always is one
+    TextClipRectangle scissor{};
+    text_buffer_manager_->GetScissor(text_buffer_, GetTransform(), scissor);
+    return scissor;
+}
+
+TextTransform TextDocumentView::GetTransform() const {
+    TextTransform transform;
+    transform.x = viewport_x_ - scroll_x_;
+    transform.y = viewport_y_ + (float) first_visible_line_ * line_height_ - scroll_y_;
+    return transform;
+}
+
+void TextDocumentView::IndexLines(uint32_t from_offset) {
+    const char *current = text_ + from_offset;
+    const char *end = text_ + text_size_;
+
+    while (current < end) {
+        const auto *new_line = (const char *) memchr(current, '\n', end - current);
+        if (new_line == nullptr) {
+            break;
+        }
+
+        current = new_line + 1;
+        if (current < end) {
+            line_offsets_.push_back((uint32_t) (current - text_));
+        }
+    }
+}
+
+void TextDocumentView::GetVisibleLineRange(uint32_t &first_line, uint32_t &last_line) const {
+    const auto line_count = (uint32_t) line_offsets_.size();
+    if (text_ == nullptr || line_count == 0 || line_height_ <= 0.0f) {
+        first_line = last_line = 0;
+        return;
+    }
+
+    const float top = bx::max(scroll_y_, 0.0f);
+    const float bottom = scroll_y_ + viewport_height_;
+    first_line = bx::min((uint32_t) (top / line_height_), line_count);
+    last_line = bottom > 0.0f ? bx::min((uint32_t) bx::ceil(bottom / line_height_), line_count) : 0;
+}
+
+float TextDocumentView::GetLayoutLeft() const {
+    if (viewport_width_ <= 0.0f) {
+        return 0.0f;
+    }
+
+    return bx::floor(bx::max(scroll_x_, 0.0f) / viewport_width_) * viewport_width_;
+}
+
+void TextDocumentView::LayoutLines(uint32_t first_line, uint32_t last_line, float layout_left) {
+    text_buffer_manager_->ClearTextBuffer(text_buffer_);
+    first_visible_line_ = first_line;
+    last_visible_line_ = last_line;
+    layout_left_ = layout_left;
+
+    // the glyphs of the page holding the viewport and the next one get vertices, so scrolling within the page
+    // only changes the transform, the others just advance the pen. The scissor set by SetViewport cuts the
+    // vertices down to the viewport.
+    const float layout_height = (float) (last_line - first_line) * line_height_;
+    text_buffer_manager_->SetClipRectangle(text_buffer_, layout_left, 0.0f, 2.0f * viewport_width_, layout_height);
+
+    const auto line_count = (uint32_t) line_offsets_.size();
+    for (uint32_t line = first_line; line < last_line; line++) {
+        const char *line_start = text_ + line_offsets_[line];
+        const char *line_end = text_ + (line + 1 < line_count ? line_offsets_[line + 1] : text_size_);
+
+        // the line break is not drawn, it would move the pen to the next line
+        while (line_end > line_start && (line_end[-1] == '\n' || line_end[-1] == '\r')) {
+            line_end--;
+        }
+        if (line_end == line_start) {
+            continue;
+        }
+
+        text_buffer_manager_->SetPenPosition(text_buffer_, 0.0f, (float) (line - first_line) * line_height_);
+        text_buffer_manager_->AppendText(text_buffer_, font_handle_, line_start, line_end);
+    }
+}
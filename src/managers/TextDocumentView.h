@@ -0,0 +1,91 @@
+﻿#pragma once
+
+#include <vector>
+
+#include "TextBufferManager.h"
+
+// TextDocumentView renders a large utf-8 document through a single text buffer.
+// The document is indexed once by line and only the lines intersecting the viewport
+// are laid out, so the vertex count and the per-frame cost depend on the visible lines
+// instead of the size of the document. Within a line only the glyphs near the viewport get
+// vertices, so a very long line can't fill the buffer. The vertex storage of the text buffer
+// is reused while scrolling and the layout is only redone when the range of visible lines
+// or the horizontal page of the viewport changes.
+class TextDocumentView {
+public:
+    /// @remark the ownership of the managers is not taken
+    TextDocumentView(TextBufferManager *text_buffer_manager, FontManager *font_manager, FontHandle font_handle, FontType font_type);
+    ~TextDocumentView();
+
+    TextDocumentView(const TextDocumentView &) = delete;
+    TextDocumentView &operator=(const TextDocumentView &) = delete;
+
+    /// set the document and rebuild the line index
+    /// @remark the text is not copied, it must stay valid until it is replaced or the view is destroyed
+    void SetDocument(const char *text, uint32_t size);
+
+    /// the document grew (e.g. a log file), only the lines after the last indexed one are indexed again
+    /// @remark the text must start with the previously set document
+    void ExtendDocument(const char *text, uint32_t size);
+
+    /// the screen rectangle the document is drawn into, the text laid out beyond it is cut by a scissor
+    void SetViewport(float x, float y, float width, float height);
+
+    /// the document position shown at the top left corner of the viewport
+    void SetScroll(float x, float y);
+
+    /// lay out the visible lines if the range of visible lines or the horizontal page changed and submit them,
+    /// the scroll position is applied as the transform of the text buffer
+    void Submit(bgfx::ViewId id, int32_t depth = 0);
+
+    [[nodiscard]] uint32_t GetLineCount() const {
+        return (uint32_t) line_offsets_.size();
+    }
+
+    [[nodiscard]] float GetLineHeight() const {
+        return line_height_;
+    }
+
+    [[nodiscard]] float GetDocumentHeight() const {
+        return line_height_ * (float) line_offsets_.size();
+    }
+
+    /// index of the first and one past the last line laid out on the last submit
+    [[nodiscard]] uint32_t GetFirstVisibleLine() const {
+        return first_visible_line_;
+    }
+
+    [[nodiscard]] uint32_t GetLastVisibleLine() const {
+        return last_visible_line_;
+    }
+
+    /// the scissor in whole screen units Submit draws the laid out lines with
+    [[nodiscard]] TextClipRectangle GetScissor() const;
+
+private:
+    void IndexLines(uint32_t from_offset);
+    void GetVisibleLineRange(uint32_t &first_line, uint32_t &last_line) const;
+    /// left edge of the horizontal page holding the left edge of the viewport, in document space
+    [[nodiscard]] float GetLayoutLeft() const;
+    void LayoutLines(uint32_t first_line, uint32_t last_line, float layout_left);
+    [[nodiscard]] TextTransform GetTransform() const;
+
+    TextBufferManager *text_buffer_manager_;
+    FontHandle font_handle_;
+    TextBufferHandle text_buffer_{};
+
+    const char *text_{};
+    uint32_t text_size_{};
+    // byte offset of the first character of every line
+    std::vector<uint32_t> line_offsets_;
+    // all the lines use the same font, so they all have the same height
+    float line_height_;
+
+    float viewport_x_{}, viewport_y_{}, viewport_width_{}, viewport_height_{};
+    float scroll_x_{}, scroll_y_{};
+
+    uint32_t first_visible_line_{};
+    uint32_t last_visible_line_{};
+    float layout_left_{};
+    bool dirty_ = true;
+};
@@ -3,14 +3,19 @@
 //
 
 #include <freetype/ftoutln.h>
+#include <algorithm>
 #include <cmath>
 
 #include "MsdfGenerator.h"
 #include "../utilities.h"
 #include "../font_decomposition/FontParser.h"
 
-void MsdfGenerator::Init(FT_Face face, uint32_t font_size, uint32_t padding, bool apply_preprocessing) {
+// line segments a curve is flattened to for the inside/outside test of the far field
+#define FAR_FIELD_EDGE_STEPS 8
+
+void MsdfGenerator::Init(FT_Face face, OutlineCache* outline_cache, uint32_t font_size, uint32_t padding, bool apply_preprocessing) {
     face_ = face;
+    outline_cache_ = outline_cache;
     font_size_ = font_size;
     padding_ = padding;
 
@@ -46,21 +51,45 @@ double MsdfGenerator::CalculateFontScale() {
     return (double) std::max(max_width, max_height) / font_size_;
 }
 
-void MsdfGenerator::BakeGlyphSdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t *output) {
-    auto shape = FontParser::ParseFtFace(code_point, &face_, 1.0);
-    if (apply_preprocessing_) shape.ApplyPreprocessing();
+bool MsdfGenerator::BakeGlyphSdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t *output) {
+    GlyphOutline temporary_outline;
+    const auto outline = GetGlyphOutline(code_point, temporary_outline);
+    if (!outline) return false;
+
+    BakeOutlineSdf(*outline, glyph_info, output);
+    shape_arena_.Reset();
+    return true;
+}
+
+bool MsdfGenerator::BakeGlyphMsdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t *output) {
+    GlyphOutline temporary_outline;
+    const auto outline = GetGlyphOutline(code_point, temporary_outline);
+    if (!outline) return false;
 
-    FT_BBox_ bbox{};
-    FT_Outline_Get_CBox(&face_->glyph->outline, &bbox);
+    BakeOutlineMsdf(*outline, glyph_info, output);
+    shape_arena_.Reset();
+    return true;
+}
+
+void MsdfGenerator::BakeOutlineSdf(const GlyphOutline &outline, GlyphInfo &glyph_info, uint8_t *output) {
+    const auto &shape = outline.shape;
+    const auto &bbox = outline.bbox;
     auto distance_range = std::max(bbox.xMax - bbox.xMin, bbox.yMax - bbox.yMin);
 
-    CalculateGlyphMetrics(bbox, glyph_info);
+    CalculateGlyphMetrics(outline, glyph_info);
+    const bool use_far_field = narrow_band_ && ClassifyFarField(shape, bbox, distance_range);
 
     for (int y = 0; y < texture_height_; y++) {
         for (int x = 0; x < texture_width_; x++) {
-            auto p = GetGlyphCoordinate(Vector2(x, y), bbox);
-            auto distance = GenerateSdfPixel(shape, p);
-            auto clamped = ClampDistanceToRange(distance, distance_range);
+            const int far_field_sign = use_far_field ? far_field_[y * texture_width_ + x] : 0;
+            double clamped;
+            if (far_field_sign != 0) {
+                clamped = far_field_sign * distance_range / 2.0;
+            } else {
+                auto p = GetGlyphCoordinate(Vector2(x, y), bbox);
+                auto distance = GenerateSdfPixel(shape, p);
+                clamped = ClampDistanceToRange(distance, distance_range);
+            }
             auto mapped_distance = MapDistanceToColorValue(clamped, distance_range);
 
             auto index = GetFlippedIndexFromCoordinate(x, y);
@@ -73,23 +102,26 @@ void MsdfGenerator::BakeGlyphSdf(CodePoint code_point, GlyphInfo &glyph_info, ui
     }
 }
 
-void MsdfGenerator::BakeGlyphMsdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t *output) {
-    auto shape = FontParser::ParseFtFace(code_point, &face_, 1.0);
-    if (apply_preprocessing_) shape.ApplyPreprocessing();
-    shape.ApplyEdgeColoring(15.0);
-    
-    FT_BBox_ bbox{};
-    FT_Outline_Get_CBox(&face_->glyph->outline, &bbox);
+void MsdfGenerator::BakeOutlineMsdf(const GlyphOutline &outline, GlyphInfo &glyph_info, uint8_t *output) {
+    const auto &shape = outline.shape;
+    const auto &bbox = outline.bbox;
     auto distance_range = std::max(bbox.xMax - bbox.xMin, bbox.yMax - bbox.yMin);
 
-    CalculateGlyphMetrics(bbox, glyph_info);
+    CalculateGlyphMetrics(outline, glyph_info);
+    const bool use_far_field = narrow_band_ && ClassifyFarField(shape, bbox, distance_range);
 
     // general msdf generation loop
     for (int y = 0; y < texture_height_; y++) {
         for (int x = 0; x < texture_width_; x++) {
-            auto p = GetGlyphCoordinate(Vector2(x, y), bbox);
-            auto res = GenerateMsdfPixel(shape, p);
-            ClampArrayToRange(res, distance_range);
+            const int far_field_sign = use_far_field ? far_field_[y * texture_width_ + x] : 0;
+            std::array<double, 3> res{};
+            if (far_field_sign != 0) {
+                res.fill(far_field_sign * distance_range / 2.0);
+            } else {
+                auto p = GetGlyphCoordinate(Vector2(x, y), bbox);
+                res = GenerateMsdfPixel(shape, p);
+                ClampArrayToRange(res, distance_range);
+            }
 
             int index = GetFlippedIndexFromCoordinate(x, y);
             output[index + 0] = MapDistanceToColorValue(res[0], distance_range);    // B
@@ -102,6 +134,64 @@ void MsdfGenerator::BakeGlyphMsdf(CodePoint code_point, GlyphInfo &glyph_info, u
     MsdfCollisionCorrection(output, collision_correction_threshold_);
 }
 
+bool MsdfGenerator::BakeGlyphPlaceholder(CodePoint code_point, GlyphInfo &glyph_info, uint8_t *output) {
+    GlyphOutline temporary_outline;
+    const auto outline = GetGlyphOutline(code_point, temporary_outline);
+    if (!outline) return false;
+
+    const auto &bbox = outline->bbox;
+    auto distance_range = std::max(bbox.xMax - bbox.xMin, bbox.yMax - bbox.yMin);
+
+    const int outside_sign = FlattenOutline(outline->shape);
+    if (outside_sign == 0) {
+        // nothing to search without edges, the real glyph is just as fast
+        shape_arena_.Reset();
+        return BakeGlyphSdf(code_point, glyph_info, output);
+    }
+
+    CalculateGlyphMetrics(*outline, glyph_info);
+    far_field_.assign(texture_width_ * texture_height_, 1);
+    ClassifyInsideOutside(bbox, outside_sign);
+
+    for (int y = 0; y < texture_height_; y++) {
+        for (int x = 0; x < texture_width_; x++) {
+            auto mapped_distance = MapDistanceToColorValue(far_field_[y * texture_width_ + x] * distance_range / 2.0, distance_range);
+
+            auto index = GetFlippedIndexFromCoordinate(x, y);
+            output[index + 0] = mapped_distance;
+            output[index + 1] = mapped_distance;
+            output[index + 2] = mapped_distance;
+            output[index + 3] = 255;
+        }
+    }
+
+    shape_arena_.Reset();
+    return true;
+}
+
+void MsdfGenerator::GetGlyphMetrics(CodePoint code_point, GlyphInfo &glyph_info) {
+    GlyphOutline temporary_outline;
+    const auto outline = GetGlyphOutline(code_point, temporary_outline);
+    if (!outline) return;
+
+    CalculateGlyphMetrics(*outline, glyph_info);
+    shape_arena_.Reset();
+}
+
+const GlyphOutline *MsdfGenerator::GetGlyphOutline(CodePoint code_point, GlyphOutline &temporary_outline) {
+    const auto glyph_index = FT_Get_Char_Index(face_, code_point);
+    if (outline_cache_) {
+        return outline_cache_->GetOutline(glyph_index, apply_preprocessing_);
+    }
+
+    // without a cache the outline lives in the per-bake arena which is reset after the bake
+    if (!OutlineCache::LoadOutline(face_, glyph_index, apply_preprocessing_, EDGE_COLORING_MAX_ANGLE, &shape_arena_, temporary_outline)) {
+        PrintError("Failed to load glyph");
+        return nullptr;
+    }
+    return &temporary_outline;
+}
+
 std::array<double, 3> MsdfGenerator::GenerateMsdfPixel(const Shape &shape, const Vector2 &p) {
     // struct to hold the closest edge for each color
     struct {
@@ -171,11 +261,91 @@ void MsdfGenerator::ClampArrayToRange(std::array<double, 3> &array, double dista
     }
 }
 
-void MsdfGenerator::CalculateGlyphMetrics(FT_BBox_ bbox, GlyphInfo &out_glyph_info) const {
+bool MsdfGenerator::ClassifyFarField(const Shape &shape, const FT_BBox_ &bbox, double distance_range) {
+    // the pixels of the far field are farther from the curves than the polyline strays from them, so they are on
+    // the same side of both
+    const int outside_sign = FlattenOutline(shape);
+    if (outside_sign == 0) return false;
+
+    // the pixels whose distance can be smaller than the clamped range are inside the dilated bounds of an edge
+    far_field_.assign(texture_width_ * texture_height_, 1);
+    const auto half_range = distance_range / 2.0;
+    const auto origin = GetGlyphCoordinate(Vector2(0, 0), bbox);
+    for (const auto &c: shape.contours) {
+        for (const auto &e: c.edges) {
+            Vector2 min, max;
+            e->GetBounds(min, max);
+            const int x0 = std::max(0, (int) std::floor((min.x - half_range - origin.x) / font_scale_));
+            const int y0 = std::max(0, (int) std::floor((min.y - half_range - origin.y) / font_scale_));
+            const int x1 = std::min(texture_width_ - 1, (int) std::ceil((max.x + half_range - origin.x) / font_scale_));
+            const int y1 = std::min(texture_height_ - 1, (int) std::ceil((max.y + half_range - origin.y) / font_scale_));
+            for (int y = y0; y <= y1; y++) {
+                std::fill_n(far_field_.begin() + y * texture_width_ + x0, std::max(0, x1 - x0 + 1), 0);
+            }
+        }
+    }
+
+    ClassifyInsideOutside(bbox, outside_sign);
+    return true;
+}
+
+int MsdfGenerator::FlattenOutline(const Shape &shape) {
+    far_field_polyline_.clear();
+    double area = 0;
+    for (const auto &c: shape.contours) {
+        for (const auto &e: c.edges) {
+            auto previous = e->GetPoint(0);
+            for (int i = 1; i <= FAR_FIELD_EDGE_STEPS; i++) {
+                auto current = e->GetPoint((double) i / FAR_FIELD_EDGE_STEPS);
+                far_field_polyline_.emplace_back(previous, current);
+                area += previous.Cross(current);
+                previous = current;
+            }
+        }
+    }
+    if (far_field_polyline_.empty()) return 0;
+
+    // the sign of a distance follows the orientation of the outline, which differs between font formats
+    return area > 0 ? 1 : -1;
+}
+
+void MsdfGenerator::ClassifyInsideOutside(const FT_BBox_ &bbox, int outside_sign) {
+    const auto origin = GetGlyphCoordinate(Vector2(0, 0), bbox);
+
+    // nonzero winding rule, the crossings of each row with the polyline are walked from left to right
+    for (int y = 0; y < texture_height_; y++) {
+        int8_t *row = far_field_.data() + y * texture_width_;
+        if (std::find(row, row + texture_width_, 1) == row + texture_width_) continue;
+
+        const auto row_y = GetGlyphCoordinate(Vector2(0, y), bbox).y;
+        far_field_crossings_.clear();
+        int winding = 0;
+        for (const auto &[a, b]: far_field_polyline_) {
+            if ((a.y <= row_y) == (b.y <= row_y)) continue;
+
+            const int direction = b.y > a.y ? 1 : -1;
+            far_field_crossings_.emplace_back(a.x + (row_y - a.y) * (b.x - a.x) / (b.y - a.y), direction);
+            winding += direction;
+        }
+        std::sort(far_field_crossings_.begin(), far_field_crossings_.end());
+
+        size_t next_crossing = 0;
+        for (int x = 0; x < texture_width_; x++) {
+            const auto pixel_x = origin.x + x * font_scale_;
+            for (; next_crossing < far_field_crossings_.size() && far_field_crossings_[next_crossing].first <= pixel_x; next_crossing++) {
+                winding -= far_field_crossings_[next_crossing].second;
+            }
+            if (row[x] != 0) row[x] = winding != 0 ? -outside_sign : outside_sign;
+        }
+    }
+}
+
+void MsdfGenerator::CalculateGlyphMetrics(const GlyphOutline &outline, GlyphInfo &out_glyph_info) const {
+    const auto &bbox = outline.bbox;
     out_glyph_info.width = texture_width_;
     out_glyph_info.height = texture_height_;
-    out_glyph_info.advance_x = std::floor(face_->glyph->advance.x * (1.0 / font_scale_));
-    out_glyph_info.advance_y = std::floor(face_->glyph->advance.y * (1.0 / font_scale_));
+    out_glyph_info.advance_x = std::floor(outline.advance.x * (1.0 / font_scale_));
+    out_glyph_info.advance_y = std::floor(outline.advance.y * (1.0 / font_scale_));
     out_glyph_info.offset_x = -bbox.xMin * (1.0 / font_scale_) - padding_;
     out_glyph_info.offset_y = -bbox.yMin * (1.0 / font_scale_) - padding_;
 }
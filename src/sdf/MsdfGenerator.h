@@ -6,30 +6,61 @@
 
 #include <freetype/freetype.h>
 #include <array>
+#include <vector>
 
 #include "../font_processing/TrueTypeFont.h"
 #include "../font_decomposition/Shape.h"
 #include "../font_decomposition/Contour.h"
 #include "../font_decomposition/Vector2.h"
+#include "../font_decomposition/ShapeArena.h"
+#include "../font_decomposition/OutlineCache.h"
 
 class MsdfGenerator {
 private:
     
 public:
-    void Init(FT_Face face, uint32_t font_size, uint32_t padding, bool apply_preprocessing = false);
+    /// @param outline_cache cache of decomposed outlines shared by all the generators of the same face,
+    /// if it's null every bake decomposes the glyph again
+    void Init(FT_Face face, OutlineCache* outline_cache, uint32_t font_size, uint32_t padding, bool apply_preprocessing = false);
     
-    void BakeGlyphMsdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t* output);
-    void BakeGlyphSdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t* output);
+    /// @return false if the outline of the glyph couldn't be loaded, nothing is baked then
+    bool BakeGlyphMsdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t* output);
+    bool BakeGlyphSdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t* output);
+    /// Bake an outline that doesn't have to belong to the face, in the font units of the face.
+    /// @remark the edges must be colored (see Shape::ApplyEdgeColoring) for BakeOutlineMsdf
+    void BakeOutlineMsdf(const GlyphOutline& outline, GlyphInfo &glyph_info, uint8_t* output);
+    void BakeOutlineSdf(const GlyphOutline& outline, GlyphInfo &glyph_info, uint8_t* output);
+    /// Bake a quick stand-in with the same metrics and texture size as BakeGlyphSdf and BakeGlyphMsdf. Every pixel
+    /// only gets the saturated distance of its side of the outline, no distance is searched.
+    /// @return false if the outline of the glyph couldn't be loaded, nothing is baked then
+    bool BakeGlyphPlaceholder(CodePoint code_point, GlyphInfo &glyph_info, uint8_t* output);
+    /// The metrics the bakes give a glyph, only its outline is loaded.
+    void GetGlyphMetrics(CodePoint code_point, GlyphInfo &glyph_info);
     
     std::array<double, 3> GenerateMsdfPixel(const Shape& shape, const Vector2& p);
     double GenerateSdfPixel(const Shape& shape, const Vector2& p);
     
+    /// Only search the nearest edge for the pixels within the clamped distance range of an edge (the narrow band),
+    /// the pixels farther away always saturate and get the clamped distance signed by an inside/outside test.
+    /// Enabled by default.
+    void SetNarrowBand(bool narrow_band) { narrow_band_ = narrow_band; }
+    
 private:
     [[nodiscard]] int MapDistanceToColorValue(double distance, double distance_range) const;
     [[nodiscard]] double ClampDistanceToRange(double distance, double distance_range) const;
     void ClampArrayToRange(std::array<double, 3>& array, double distance_range);
     
-    void CalculateGlyphMetrics(FT_BBox_ bbox, GlyphInfo &out_glyph_info) const;
+    /// fill far_field_ with 0 for the pixels in the narrow band and the sign of the saturated distance for the others
+    /// @return false if the shape has no edges, every pixel is then computed exactly
+    bool ClassifyFarField(const Shape& shape, const FT_BBox_& bbox, double distance_range);
+    /// flatten the outline into far_field_polyline_
+    /// @return the sign of the distances outside of the shape, 0 if the shape has no edges
+    int FlattenOutline(const Shape& shape);
+    /// replace the non zero entries of far_field_ with the sign of the distance of their pixel
+    void ClassifyInsideOutside(const FT_BBox_& bbox, int outside_sign);
+    
+    const GlyphOutline* GetGlyphOutline(CodePoint code_point, GlyphOutline& temporary_outline);
+    void CalculateGlyphMetrics(const GlyphOutline& outline, GlyphInfo &out_glyph_info) const;
     
     [[nodiscard]] double CalculateFontScale();
     
@@ -52,6 +83,17 @@ private:
     
     int collision_correction_threshold_;
     bool apply_preprocessing_;
+    bool narrow_band_ = true;
+    
+    // scratch memory of the narrow band, kept between bakes
+    std::vector<int8_t> far_field_;
+    std::vector<std::pair<Vector2, Vector2>> far_field_polyline_;
+    std::vector<std::pair<float, int>> far_field_crossings_;
+    
+    // edges of the glyph being baked are allocated here and released after each bake
+    // (only used when there is no outline cache)
+    ShapeArena shape_arena_;
+    OutlineCache* outline_cache_ = nullptr;
     
     FT_Face face_;
 };
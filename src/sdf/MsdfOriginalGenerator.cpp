@@ -6,18 +6,20 @@
 #include "MsdfOriginalGenerator.h"
 #include "../utilities.h"
 
-MsdfOriginalGenerator::MsdfOriginalGenerator() {
-    ft_ = msdfgen::initializeFreetype();
+MsdfOriginalGenerator::~MsdfOriginalGenerator() {
+    if (font_) msdfgen::destroyFont(font_);
 }
 
-void MsdfOriginalGenerator::Init(const std::string &font_path, FT_Face face, int font_size, int padding) {
+void MsdfOriginalGenerator::Init(FT_Face face, int font_size, int padding) {
     font_size_ = font_size;
     face_ = face;
     padding_ = padding;
     texture_width = font_size + 2 * padding;
     texture_height = font_size + 2 * padding;
     
-    font_ = msdfgen::loadFont(ft_, font_path.c_str());
+    // reuse the already opened face instead of loading the font file again
+    if (font_) msdfgen::destroyFont(font_);
+    font_ = msdfgen::adoptFreetypeFont(face);
     if (!font_) PrintError("Failed to load font");
 
     // calculate scale
@@ -35,11 +37,11 @@ void MsdfOriginalGenerator::Init(const std::string &font_path, FT_Face face, int
     scale_ = (double) std::max(max_width, max_height) / font_size_;
 }
 
-void MsdfOriginalGenerator::BakeGlyphMsdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t *output) {
+bool MsdfOriginalGenerator::BakeGlyphMsdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t *output) {
     msdfgen::Shape shape;
     if (!msdfgen::loadGlyph(shape, font_, code_point, msdfgen::FONT_SCALING_EM_NORMALIZED)) {
         PrintError("Failed to load glyph");
-        return;
+        return false;
     }
 
     CalculateGlyphInfo(glyph_info, code_point);
@@ -61,6 +63,7 @@ void MsdfOriginalGenerator::BakeGlyphMsdf(CodePoint code_point, GlyphInfo &glyph
             output[index + 3] = 255;
         }
     }
+    return true;
 }
 
 void MsdfOriginalGenerator::CalculateGlyphInfo(GlyphInfo &out_glyph_info, CodePoint code_point) {
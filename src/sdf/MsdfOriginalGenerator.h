@@ -11,20 +11,23 @@
 
 class MsdfOriginalGenerator {
 public:
-    MsdfOriginalGenerator();
-    void Init(const std::string& font_path, FT_Face face, int font_size, int padding);
-    void BakeGlyphMsdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t *output);
-    
-private:
+    MsdfOriginalGenerator() = default;
+    ~MsdfOriginalGenerator();
+    /// @remark the face is not owned by the generator and must outlive it
+    void Init(FT_Face face, int font_size, int padding);
+    /// @return false if the glyph couldn't be loaded, nothing is baked then
+    bool BakeGlyphMsdf(CodePoint code_point, GlyphInfo &glyph_info, uint8_t *output);
+    /// the metrics BakeGlyphMsdf gives a glyph, without generating it
     void CalculateGlyphInfo(GlyphInfo &out_glyph_info, CodePoint code_point);
     
+private:
+
     FT_Face face_{};
     double scale_{};
     int padding_{};
     int texture_width{};
     int texture_height{};
     
-    msdfgen::FreetypeHandle *ft_;
     msdfgen::FontHandle *font_{};
     
     int font_size_{};
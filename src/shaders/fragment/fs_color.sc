@@ -1,4 +1,4 @@
-$input v_color0, v_texcoord0
+$input v_color0, v_color1, v_texcoord0
 
 #include "../common/common.sh"
 
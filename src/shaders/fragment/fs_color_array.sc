@@ -0,0 +1,11 @@
+$input v_color0, v_color1, v_texcoord0
+
+#include "../common/common.sh"
+
+SAMPLER2DARRAY(s_texColor, 0);
+
+void main() {
+    float layer = floor(v_texcoord0.z*32767.0 + 0.5);
+    vec4 color = texture2DArray(s_texColor, vec3(v_texcoord0.xy, layer));
+    gl_FragColor = vec4(color);
+}
@@ -0,0 +1,16 @@
+$input v_color0, v_color1, v_texcoord0
+
+#include "../common/common.sh"
+
+SAMPLER2DARRAY(s_texColor, 0);
+
+void main()
+{
+	float layer = floor(v_texcoord0.z*32767.0 + 0.5);
+	vec4 color = texture2DArray(s_texColor, vec3(v_texcoord0.xy, layer));
+	int index = int(v_texcoord0.w*4.0 + 0.5);
+	float alpha = index < 1 ? color.z :
+		index < 2 ? color.y :
+		index < 3 ? color.x : color.w;
+	gl_FragColor = vec4(v_color0.xyz, v_color0.a * alpha);
+}
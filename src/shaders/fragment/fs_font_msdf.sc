@@ -1,4 +1,4 @@
-$input v_color0, v_texcoord0
+$input v_color0, v_color1, v_texcoord0
 
 #include "../common/common.sh"
 
@@ -8,12 +8,16 @@ float median(float a, float b, float c) {
     return a + b + c - min(a, min(b, c)) - max(a, max(b, c));
 }
 
+// distance of the outer outline edge, the glyph edge is at 0.5
+#define OUTLINE_EDGE 0.25
+
 void main() {
     vec4 color = textureCube(s_texColor, v_texcoord0.xyz);
     float d = median(color.r, color.g, color.b);
     
     float aaf = fwidth(d) * 0.75;
     float alpha = smoothstep(0.5 - aaf, 0.5 + aaf, d);
+    float outline = smoothstep(OUTLINE_EDGE - aaf, OUTLINE_EDGE + aaf, d) * v_color1.a;
     
-    gl_FragColor = vec4(1.0, 1.0, 1.0, alpha);
+    gl_FragColor = mix(vec4(v_color1.rgb, outline), v_color0, alpha);
 }
@@ -0,0 +1,24 @@
+$input v_color0, v_color1, v_texcoord0
+
+#include "../common/common.sh"
+
+SAMPLER2DARRAY(s_texColor, 0);
+
+float median(float a, float b, float c) {
+    return a + b + c - min(a, min(b, c)) - max(a, max(b, c));
+}
+
+// distance of the outer outline edge, the glyph edge is at 0.5
+#define OUTLINE_EDGE 0.25
+
+void main() {
+    float layer = floor(v_texcoord0.z*32767.0 + 0.5);
+    vec4 color = texture2DArray(s_texColor, vec3(v_texcoord0.xy, layer));
+    float d = median(color.r, color.g, color.b);
+    
+    float aaf = fwidth(d) * 0.75;
+    float alpha = smoothstep(0.5 - aaf, 0.5 + aaf, d);
+    float outline = smoothstep(OUTLINE_EDGE - aaf, OUTLINE_EDGE + aaf, d) * v_color1.a;
+    
+    gl_FragColor = mix(vec4(v_color1.rgb, outline), v_color0, alpha);
+}
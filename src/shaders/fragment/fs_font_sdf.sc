@@ -1,16 +1,22 @@
-$input v_color0, v_texcoord0
+$input v_color0, v_color1, v_texcoord0
 
 #include "../common/common.sh"
 
 SAMPLERCUBE(s_texColor, 0);
 
+// distance of the outer outline edge, the glyph edge is at 0.5
+#define OUTLINE_EDGE 0.25
+
 void main() {
-    vec4 out_color = vec4(1,1,1,1);
 	vec4 color = textureCube(s_texColor, v_texcoord0.xyz);
-	float d = color.b;
+	int index = int(v_texcoord0.w*4.0 + 0.5);
+	float d = index < 1 ? color.z :
+		index < 2 ? color.y :
+		index < 3 ? color.x : color.w;
     
     float aaf = fwidth(d);
     float alpha = smoothstep(0.5 - aaf, 0.5 + aaf, d);
+    float outline = smoothstep(OUTLINE_EDGE - aaf, OUTLINE_EDGE + aaf, d) * v_color1.a;
     
-    gl_FragColor = vec4(out_color.rgb, alpha);
+    gl_FragColor = mix(vec4(v_color1.rgb, outline), v_color0, alpha);
 }
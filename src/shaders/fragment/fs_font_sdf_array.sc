@@ -0,0 +1,23 @@
+$input v_color0, v_color1, v_texcoord0
+
+#include "../common/common.sh"
+
+SAMPLER2DARRAY(s_texColor, 0);
+
+// distance of the outer outline edge, the glyph edge is at 0.5
+#define OUTLINE_EDGE 0.25
+
+void main() {
+	float layer = floor(v_texcoord0.z*32767.0 + 0.5);
+	vec4 color = texture2DArray(s_texColor, vec3(v_texcoord0.xy, layer));
+	int index = int(v_texcoord0.w*4.0 + 0.5);
+	float d = index < 1 ? color.z :
+		index < 2 ? color.y :
+		index < 3 ? color.x : color.w;
+    
+    float aaf = fwidth(d);
+    float alpha = smoothstep(0.5 - aaf, 0.5 + aaf, d);
+    float outline = smoothstep(OUTLINE_EDGE - aaf, OUTLINE_EDGE + aaf, d) * v_color1.a;
+    
+    gl_FragColor = mix(vec4(v_color1.rgb, outline), v_color0, alpha);
+}
@@ -1,5 +1,5 @@
-$input a_position, a_color0, a_texcoord0
-$output v_color0, v_texcoord0
+$input a_position, a_color0, a_color1, a_texcoord0
+$output v_color0, v_color1, v_texcoord0
 
 #include "../common/common.sh"
 
@@ -8,4 +8,5 @@ void main()
 	gl_Position = mul(u_modelViewProj, vec4(a_position, 0.0, 1.0) );
 	v_texcoord0 = a_texcoord0;
 	v_color0 = a_color0;
+	v_color1 = a_color1;
 }
@@ -0,0 +1,156 @@
+﻿#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "../src/font_processing/BlockCompression.h"
+
+#define FIELD_SIZE 64
+#define FIELD_SPREAD 6.0f
+
+struct FieldError {
+    double mean = 0.0;
+    int max = 0;
+    // mean error of the texels around the edge (the distance 0.5 the shaders threshold at)
+    double edge_mean = 0.0;
+    // texels far enough from the edge to stay on their side, that changed side after decoding
+    int flipped = 0;
+};
+
+static uint8_t EncodeDistance(float distance) {
+    return (uint8_t) std::clamp(std::lround(127.5f + distance * 127.5f / FIELD_SPREAD), 0L, 255L);
+}
+
+// distance to a circle, the sdf of a round glyph
+static std::vector<uint8_t> CircleField() {
+    std::vector<uint8_t> field(FIELD_SIZE * FIELD_SIZE);
+    for (int y = 0; y < FIELD_SIZE; y++) {
+        for (int x = 0; x < FIELD_SIZE; x++) {
+            field[y * FIELD_SIZE + x] = EncodeDistance(20.0f - std::hypot((float) x - 31.5f, (float) y - 31.5f));
+        }
+    }
+    return field;
+}
+
+// the msdf of a square with its edges split between the channels, the channels only part at the corners
+static std::vector<uint8_t> SquareMsdfField() {
+    std::vector<uint8_t> field(FIELD_SIZE * FIELD_SIZE * 4);
+    for (int y = 0; y < FIELD_SIZE; y++) {
+        for (int x = 0; x < FIELD_SIZE; x++) {
+            const float top = (float) y - 12.0f;
+            const float right = 52.0f - (float) x;
+            const float bottom = 52.0f - (float) y;
+            const float left = (float) x - 12.0f;
+            uint8_t *texel = field.data() + (y * FIELD_SIZE + x) * 4;
+            texel[2] = EncodeDistance(std::min({top, bottom, left}));
+            texel[1] = EncodeDistance(std::min({top, right, left}));
+            texel[0] = EncodeDistance(std::min(right, bottom));
+            texel[3] = 255;
+        }
+    }
+    return field;
+}
+
+template<typename Encode, typename Decode>
+static std::vector<uint8_t> RoundTrip(const std::vector<uint8_t> &field, uint32_t texel_size, uint32_t block_bytes, Encode encode, Decode decode) {
+    std::vector<uint8_t> decoded(field.size());
+    const uint32_t pitch = FIELD_SIZE * texel_size;
+    uint8_t block[16];
+    for (int y = 0; y < FIELD_SIZE; y += BLOCK_COMPRESSION_BLOCK_SIZE) {
+        for (int x = 0; x < FIELD_SIZE; x += BLOCK_COMPRESSION_BLOCK_SIZE) {
+            const uint32_t offset = y * pitch + x * texel_size;
+            encode(field.data() + offset, pitch, block);
+            decode(block, decoded.data() + offset, pitch);
+        }
+    }
+    REQUIRE(block_bytes <= sizeof(block));
+    return decoded;
+}
+
+static FieldError Compare(const std::vector<uint8_t> &field, const std::vector<uint8_t> &decoded, uint32_t channel_count) {
+    FieldError error;
+    uint32_t edge_count = 0;
+    for (size_t ii = 0; ii < field.size(); ii++) {
+        if (ii % 4 == 3 && channel_count == 4) {
+            continue;
+        }
+        const int difference = std::abs((int) field[ii] - (int) decoded[ii]);
+        error.mean += difference;
+        error.max = std::max(error.max, difference);
+        if (field[ii] >= 64 && field[ii] <= 192) {
+            error.edge_mean += difference;
+            edge_count++;
+        }
+        if (std::abs((int) field[ii] - 128) >= 32 && (field[ii] >= 128) != (decoded[ii] >= 128)) {
+            error.flipped++;
+        }
+    }
+    error.mean /= (double) (field.size() / 4 * channel_count);
+    error.edge_mean /= (double) edge_count;
+    return error;
+}
+
+TEST_CASE("BlockCompression", "[BlockCompression]") {
+    SECTION("BC4 keeps a single channel distance field") {
+        const auto field = CircleField();
+        const auto decoded = RoundTrip(field, 1, 8, EncodeBlockBc4, DecodeBlockBc4);
+        const auto error = Compare(field, decoded, 1);
+        // 3 bit indices, a block spanning most of the spread quantizes in steps of about 14
+        REQUIRE(error.mean <= 4.0);
+        REQUIRE(error.max <= 8);
+        REQUIRE(error.edge_mean <= 4.0);
+        REQUIRE(error.flipped == 0);
+    }
+
+    SECTION("BC1 and BC7 keep a multi channel distance field") {
+        const auto field = SquareMsdfField();
+        const auto bc1 = Compare(field, RoundTrip(field, 4, 8, EncodeBlockBc1, DecodeBlockBc1), 3);
+        const auto bc7 = Compare(field, RoundTrip(field, 4, 16, EncodeBlockBc7, DecodeBlockBc7), 3);
+        REQUIRE(bc1.mean <= 3.0);
+        REQUIRE(bc1.edge_mean <= 4.0);
+        REQUIRE(bc1.flipped == 0);
+        REQUIRE(bc7.mean <= 2.5);
+        REQUIRE(bc7.edge_mean <= 3.0);
+        REQUIRE(bc7.flipped == 0);
+        REQUIRE(bc7.edge_mean <= bc1.edge_mean);
+    }
+
+    SECTION("A gray field survives every format") {
+        const auto gray = CircleField();
+        std::vector<uint8_t> field(gray.size() * 4);
+        for (size_t ii = 0; ii < gray.size(); ii++) {
+            field[ii * 4 + 0] = field[ii * 4 + 1] = field[ii * 4 + 2] = gray[ii];
+            field[ii * 4 + 3] = 255;
+        }
+        const auto bc1 = Compare(field, RoundTrip(field, 4, 8, EncodeBlockBc1, DecodeBlockBc1), 3);
+        const auto bc7 = Compare(field, RoundTrip(field, 4, 16, EncodeBlockBc7, DecodeBlockBc7), 3);
+        REQUIRE(bc1.flipped == 0);
+        REQUIRE(bc7.flipped == 0);
+        REQUIRE(bc7.max <= 6);
+    }
+
+    SECTION("Flat blocks are exact") {
+        for (int value: {0, 255}) {
+            uint8_t texels[64];
+            uint8_t decoded[64];
+            uint8_t block[16];
+            std::fill(texels, texels + 64, (uint8_t) value);
+
+            EncodeBlockBc4(texels, 4, block);
+            DecodeBlockBc4(block, decoded, 4);
+            REQUIRE(std::equal(texels, texels + 16, decoded));
+
+            EncodeBlockBc1(texels, 16, block);
+            DecodeBlockBc1(block, decoded, 16);
+            for (int ii = 0; ii < 16; ii++) {
+                REQUIRE(decoded[ii * 4 + 0] == value);
+                REQUIRE(decoded[ii * 4 + 1] == value);
+                REQUIRE(decoded[ii * 4 + 2] == value);
+            }
+
+            EncodeBlockBc7(texels, 16, block);
+            DecodeBlockBc7(block, decoded, 16);
+            REQUIRE(std::equal(texels, texels + 64, decoded));
+        }
+    }
+}
@@ -242,5 +242,38 @@ TEST_CASE("EdgeSegment", "[EdgeSegment]") {
             REQUIRE(angle == Approx(45));
         }
     }
+
+    SECTION("Bounds") {
+        SECTION("Linear") {
+            auto edge = EdgeHolder({7, 4}, {2, 2});
+
+            Vector2 min, max;
+            edge->GetBounds(min, max);
+
+            REQUIRE(min.x == Approx(2));
+            REQUIRE(min.y == Approx(2));
+            REQUIRE(max.x == Approx(7));
+            REQUIRE(max.y == Approx(4));
+        }
+
+        SECTION("CubicContainsCurve") {
+            auto edge = EdgeHolder({0, 0}, {-3, 5}, {6, -4}, {4, 1});
+
+            Vector2 min, max;
+            edge->GetBounds(min, max);
+
+            REQUIRE(min.x == Approx(-3));
+            REQUIRE(min.y == Approx(-4));
+            REQUIRE(max.x == Approx(6));
+            REQUIRE(max.y == Approx(5));
+            for (int i = 0; i <= 20; i++) {
+                auto point = edge->GetPoint(i / 20.0);
+                REQUIRE(point.x >= min.x);
+                REQUIRE(point.y >= min.y);
+                REQUIRE(point.x <= max.x);
+                REQUIRE(point.y <= max.y);
+            }
+        }
+    }
 }
 
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <bgfx/bgfx.h>
+#include "../src/managers/FontManager.h"
+
+/// bgfx with the Noop renderer and a font manager with OpenSans loaded, for the tests that bake glyphs or lay out
+/// text. The atlas creates its texture, no rendering happens.
+/// @remark the fonts created by a test must be destroyed before the context
+struct FontTestContext {
+    explicit FontTestContext(uint16_t atlas_size = 512) {
+        bgfx::Init init;
+        init.type = bgfx::RendererType::Noop;
+        REQUIRE(bgfx::init(init));
+
+        font_manager = new FontManager(atlas_size);
+        ttf = font_manager->CreateTtf(TEST_FONT_DIR "OpenSans-Regular.ttf");
+        REQUIRE(isValid(ttf));
+    }
+
+    ~FontTestContext() {
+        if (isValid(ttf)) {
+            font_manager->DestroyTtf(ttf);
+        }
+        delete font_manager;
+        bgfx::shutdown();
+    }
+
+    FontTestContext(const FontTestContext &) = delete;
+    FontTestContext &operator=(const FontTestContext &) = delete;
+
+    FontManager *font_manager = nullptr;
+    TrueTypeHandle ttf = BGFX_INVALID_HANDLE;
+};
@@ -0,0 +1,41 @@
+﻿#include <catch2/catch_test_macros.hpp>
+#include "FontTestContext.h"
+#include "../src/font_processing/CubeAtlas.h"
+#include "../src/font_processing/TextBuffer.h"
+
+TEST_CASE("MeasureText matches the laid out text", "[FontManager]") {
+    FontTestContext context;
+    FontManager &font_manager = *context.font_manager;
+    const TrueTypeHandle ttf = context.ttf;
+
+    const char *strings[] = {
+            "The quick brown fox jumps over the lazy dog",
+            "AVATAR Wolf, To. Ty",
+            "first line\nsecond, longer line\n\nfourth",
+            "\ttabs\tand  spaces ",
+            "",
+    };
+
+    for (FontType font_type: {FontType::Bitmap, FontType::SdfFromBitmap, FontType::SdfFromVector, FontType::Msdf}) {
+        const FontHandle font = font_manager.CreateFontByPixelSize(ttf, 0, 32, font_type);
+        const FontHandle scaled_font = font_manager.CreateScaledFontToPixelSize(font, 20);
+
+        for (FontHandle handle: {font, scaled_font}) {
+            for (const char *string: strings) {
+                const uint16_t region_count = font_manager.GetAtlas()->GetRegionCount();
+                const TextRectangle measured = font_manager.MeasureText(handle, string);
+                // measuring only reads the metrics, the glyphs are baked by the text buffer
+                CHECK(font_manager.GetAtlas()->GetRegionCount() == region_count);
+
+                TextBuffer text_buffer(&font_manager);
+                text_buffer.AppendText(handle, string);
+                const TextRectangle laid_out = text_buffer.GetRectangle();
+                CHECK(measured.width == laid_out.width);
+                CHECK(measured.height == laid_out.height);
+            }
+        }
+
+        font_manager.DestroyFont(scaled_font);
+        font_manager.DestroyFont(font);
+    }
+}
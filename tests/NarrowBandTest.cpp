@@ -0,0 +1,94 @@
+﻿#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <vector>
+#include "../src/sdf/MsdfGenerator.h"
+
+namespace {
+    // the outer contour goes one way and the hole the other, like in a font
+    void AddSquare(Shape &shape, double min, double max, bool counter_clockwise) {
+        Contour &contour = shape.AddEmptyContour();
+        if (counter_clockwise) {
+            contour.AddEdge(EdgeHolder({min, min}, {max, min}));
+            contour.AddEdge(EdgeHolder({max, min}, {max, max}));
+            contour.AddEdge(EdgeHolder({max, max}, {min, max}));
+            contour.AddEdge(EdgeHolder({min, max}, {min, min}));
+        } else {
+            contour.AddEdge(EdgeHolder({min, min}, {min, max}));
+            contour.AddEdge(EdgeHolder({min, max}, {max, max}));
+            contour.AddEdge(EdgeHolder({max, max}, {max, min}));
+            contour.AddEdge(EdgeHolder({max, min}, {min, min}));
+        }
+    }
+
+    void AddRound(Shape &shape, double center, double radius, bool counter_clockwise) {
+        const Point2 points[4] = {{center + radius, center}, {center, center + radius}, {center - radius, center}, {center, center - radius}};
+        const Point2 controls[4] = {{center + radius, center + radius}, {center - radius, center + radius},
+                                    {center - radius, center - radius}, {center + radius, center - radius}};
+        Contour &contour = shape.AddEmptyContour();
+        for (int i = 0; i < 4; i++) {
+            if (counter_clockwise) {
+                contour.AddEdge(EdgeHolder(points[i], controls[i], points[(i + 1) % 4]));
+            } else {
+                contour.AddEdge(EdgeHolder(points[(4 - i) % 4], controls[3 - i], points[3 - i]));
+            }
+        }
+    }
+
+    int Median(const uint8_t *pixel) {
+        return std::max(std::min(pixel[0], pixel[1]), std::min(std::max(pixel[0], pixel[1]), pixel[2]));
+    }
+}
+
+TEST_CASE("Narrow band", "[MsdfGenerator]") {
+    FT_Library library;
+    FT_Face face;
+    REQUIRE(FT_Init_FreeType(&library) == 0);
+    REQUIRE(FT_New_Face(library, TEST_FONT_DIR "OpenSans-Regular.ttf", 0, &face) == 0);
+
+    // the shapes are a third of the texture, so most of the padding is farther than the clamped
+    // distance from every edge. Neither has a pixel of that far field equidistant from two edges
+    // of opposite sign (a corner tie), where the search and the inside/outside test may disagree.
+    MsdfGenerator generator;
+    generator.Init(face, nullptr, 32, 8);
+
+    for (bool counter_clockwise: {true, false}) {
+        for (bool round: {false, true}) {
+            GlyphOutline outline;
+            if (round) {
+                AddRound(outline.shape, 500, 500, counter_clockwise);
+                AddRound(outline.shape, 500, 200, !counter_clockwise);
+            } else {
+                AddSquare(outline.shape, 0, 1000, counter_clockwise);
+                AddSquare(outline.shape, 300, 700, !counter_clockwise);
+            }
+            outline.shape.ApplyEdgeColoring(EDGE_COLORING_MAX_ANGLE);
+            outline.bbox = {0, 0, 1000, 1000};
+            outline.advance = {1100, 0};
+
+            GlyphInfo glyph_info{};
+            const size_t size = (size_t) 48 * 48 * 4;
+            std::vector<uint8_t> narrow_sdf(size), full_sdf(size), narrow_msdf(size), full_msdf(size);
+
+            generator.SetNarrowBand(true);
+            generator.BakeOutlineSdf(outline, glyph_info, narrow_sdf.data());
+            generator.BakeOutlineMsdf(outline, glyph_info, narrow_msdf.data());
+            generator.SetNarrowBand(false);
+            generator.BakeOutlineSdf(outline, glyph_info, full_sdf.data());
+            generator.BakeOutlineMsdf(outline, glyph_info, full_msdf.data());
+            REQUIRE(glyph_info.width * glyph_info.height * 4 == size);
+
+            CHECK(narrow_sdf == full_sdf);
+
+            // the far field fills every channel with the sign of the pixel, while the search gives a channel
+            // without an edge of its color nearby the sign of a far corner, only the median is the distance
+            size_t median_mismatches = 0;
+            for (size_t i = 0; i < size; i += 4) {
+                median_mismatches += Median(&narrow_msdf[i]) != Median(&full_msdf[i]);
+            }
+            CHECK(median_mismatches == 0);
+        }
+    }
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+}
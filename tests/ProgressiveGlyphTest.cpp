@@ -0,0 +1,53 @@
+﻿#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+#include "FontTestContext.h"
+#include "../src/font_processing/CubeAtlas.h"
+#include "../src/font_processing/TextBuffer.h"
+
+TEST_CASE("A refinement that doesn't fit in the atlas keeps the placeholder", "[FontManager]") {
+    // the faces of the atlas only have room for a few of the 32x32 msdf glyphs
+    FontTestContext context(64);
+    FontManager &font_manager = *context.font_manager;
+    const FontHandle font = font_manager.CreateFontByPixelSize(context.ttf, 0, 24, FontType::Msdf, 4);
+    font_manager.SetProgressive(font, true);
+
+    // placeholders until the atlas is full, the glyph that doesn't fit isn't cached without a region
+    std::vector<CodePoint> code_points;
+    std::vector<GlyphInfo> placeholders;
+    for (CodePoint code_point = 'A'; code_point <= 'z'; ++code_point) {
+        const GlyphInfo *glyph_info = font_manager.GetGlyphInfo(font, code_point);
+        if (glyph_info == nullptr) {
+            CHECK(font_manager.GetGlyphInfo(font, code_point) == nullptr);
+            break;
+        }
+
+        REQUIRE(glyph_info->region_index != UINT16_MAX);
+        code_points.push_back(code_point);
+        placeholders.push_back(*glyph_info);
+    }
+    REQUIRE(!code_points.empty());
+    REQUIRE(code_points.back() < 'z');
+
+    const uint16_t region_count = font_manager.GetAtlas()->GetRegionCount();
+    const uint32_t glyph_generation = font_manager.GetGlyphGeneration(font);
+    const GlyphBakeProgress progress = font_manager.Pump(UINT32_MAX);
+    CHECK(progress.refined_count == 0);
+    CHECK(progress.pending_refinement_count == 0);
+    CHECK(font_manager.GetGlyphGeneration(font) == glyph_generation);
+    CHECK(font_manager.GetAtlas()->GetRegionCount() == region_count);
+
+    for (size_t ii = 0; ii < code_points.size(); ++ii) {
+        const GlyphInfo *glyph_info = font_manager.GetGlyphInfo(font, code_points[ii]);
+        REQUIRE(glyph_info != nullptr);
+        CHECK(glyph_info->region_index == placeholders[ii].region_index);
+    }
+
+    // the text is still drawn with the placeholders
+    const std::string text(code_points.begin(), code_points.end());
+    TextBuffer text_buffer(&font_manager);
+    text_buffer.AppendText(font, text.c_str());
+    CHECK(text_buffer.GetVertexCount() == code_points.size() * 4);
+
+    font_manager.DestroyFont(font);
+}
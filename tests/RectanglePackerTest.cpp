@@ -0,0 +1,80 @@
+﻿#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../src/font_processing/RectanglePacker.h"
+
+struct PackedRectangle {
+    uint16_t x, y, width, height;
+};
+
+static bool Overlap(const PackedRectangle &a, const PackedRectangle &b) {
+    return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+// glyph like sizes, mostly small with a few large ones
+static std::vector<PackedRectangle> PackRandomSequence(RectanglePackerType::Enum type, uint32_t size, std::vector<PackedRectangle> &packed) {
+    std::unique_ptr<RectanglePacker> packer(RectanglePacker::Create(type));
+    packer->Init(size, size);
+
+    std::mt19937 random(7);
+    std::vector<PackedRectangle> rejected;
+    for (int i = 0; i < 2000; i++) {
+        auto width = (uint16_t) (4 + random() % (i % 17 == 0 ? 60 : 20));
+        auto height = (uint16_t) (6 + random() % (i % 13 == 0 ? 60 : 24));
+        uint16_t x, y;
+        if (packer->AddRectangle(width, height, x, y)) {
+            packed.push_back({x, y, width, height});
+        } else {
+            rejected.push_back({0, 0, width, height});
+        }
+    }
+    return rejected;
+}
+
+TEST_CASE("RectanglePacker", "[RectanglePacker]") {
+    for (auto type: {RectanglePackerType::Skyline, RectanglePackerType::MaxRects}) {
+        std::vector<PackedRectangle> packed;
+        PackRandomSequence(type, 256, packed);
+        REQUIRE(!packed.empty());
+
+        SECTION("Rectangles stay inside the border") {
+            for (const auto &rectangle: packed) {
+                REQUIRE(rectangle.x >= 1);
+                REQUIRE(rectangle.y >= 1);
+                REQUIRE(rectangle.x + rectangle.width <= 255);
+                REQUIRE(rectangle.y + rectangle.height <= 255);
+            }
+        }
+
+        SECTION("Rectangles don't overlap") {
+            for (size_t i = 0; i < packed.size(); i++) {
+                for (size_t j = i + 1; j < packed.size(); j++) {
+                    REQUIRE_FALSE(Overlap(packed[i], packed[j]));
+                }
+            }
+        }
+    }
+
+    SECTION("MaxRects fills the surface at least as well as Skyline") {
+        std::vector<PackedRectangle> skyline, max_rects;
+        PackRandomSequence(RectanglePackerType::Skyline, 256, skyline);
+        PackRandomSequence(RectanglePackerType::MaxRects, 256, max_rects);
+
+        uint32_t skyline_area = 0, max_rects_area = 0;
+        for (const auto &rectangle: skyline) skyline_area += rectangle.width * rectangle.height;
+        for (const auto &rectangle: max_rects) max_rects_area += rectangle.width * rectangle.height;
+        REQUIRE(max_rects_area >= skyline_area);
+    }
+
+    SECTION("Clear makes the whole surface available again") {
+        std::unique_ptr<RectanglePacker> packer(RectanglePacker::Create(RectanglePackerType::MaxRects));
+        packer->Init(64, 64);
+        uint16_t x, y;
+        REQUIRE(packer->AddRectangle(62, 62, x, y));
+        REQUIRE_FALSE(packer->AddRectangle(1, 1, x, y));
+        packer->Clear();
+        REQUIRE(packer->GetUsedSurface() == 0);
+        REQUIRE(packer->AddRectangle(62, 62, x, y));
+    }
+}
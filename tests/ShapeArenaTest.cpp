@@ -0,0 +1,67 @@
+﻿#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/font_decomposition/ShapeArena.h"
+#include "../src/font_decomposition/EdgeSegment.h"
+#include "../src/font_decomposition/Shape.h"
+
+using namespace Catch;
+
+TEST_CASE("ShapeArena", "[ShapeArena]") {
+    SECTION("Allocations are aligned") {
+        auto arena = ShapeArena(256);
+        arena.Allocate(3, 1);
+        auto ptr = arena.Allocate(16, 16);
+        REQUIRE(reinterpret_cast<uintptr_t>(ptr) % 16 == 0);
+    }
+
+    SECTION("Allocations larger than a block get their own block") {
+        auto arena = ShapeArena(64);
+        auto ptr = arena.Allocate(1000);
+        REQUIRE(ptr != nullptr);
+        REQUIRE(arena.GetCapacity() >= 1000);
+        REQUIRE(arena.GetUsedSize() >= 1000);
+    }
+
+    SECTION("Reset releases memory but keeps the blocks") {
+        auto arena = ShapeArena(128);
+        for (int i = 0; i < 100; i++) {
+            arena.Allocate(32);
+        }
+        const auto capacity = arena.GetCapacity();
+        arena.Reset();
+
+        REQUIRE(arena.GetUsedSize() == 0);
+        REQUIRE(arena.GetCapacity() == capacity);
+
+        // the same amount of allocations fits into the existing blocks
+        for (int i = 0; i < 100; i++) {
+            arena.Allocate(32);
+        }
+        REQUIRE(arena.GetCapacity() == capacity);
+    }
+
+    SECTION("Reserve avoids allocating a block later") {
+        auto arena = ShapeArena(64);
+        arena.Reserve(4096);
+        const auto capacity = arena.GetCapacity();
+        for (int i = 0; i < 32; i++) {
+            arena.Allocate(64, 8);
+        }
+        REQUIRE(arena.GetCapacity() == capacity);
+    }
+
+    SECTION("Edges allocated in the arena") {
+        auto arena = ShapeArena();
+        auto shape = Shape();
+
+        auto &contour = shape.AddEmptyContour();
+        contour.AddEdge(EdgeHolder(EdgeSegment::CreateEdgeSegment({2, 2}, {2, 7}, &arena)));
+        contour.AddEdge(EdgeHolder(EdgeSegment::CreateEdgeSegment({2, 7}, {7, 7}, &arena)));
+        contour.AddEdge(EdgeHolder(EdgeSegment::CreateEdgeSegment({7, 7}, {7, 2}, &arena)));
+        contour.AddEdge(EdgeHolder(EdgeSegment::CreateEdgeSegment({7, 2}, {2, 2}, &arena)));
+
+        REQUIRE(arena.GetUsedSize() >= 4 * sizeof(LinearSegment));
+        REQUIRE(shape.SignedDistance({4, 2.3}) == Approx(0.3));
+        REQUIRE(shape.SignedDistance({4, 1.3}) == Approx(-0.7));
+    }
+}
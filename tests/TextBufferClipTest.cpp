@@ -0,0 +1,37 @@
+﻿#include <catch2/catch_test_macros.hpp>
+#include "FontTestContext.h"
+#include "../src/font_processing/CubeAtlas.h"
+#include "../src/font_processing/TextBuffer.h"
+
+TEST_CASE("Clipping uses the aligned line position", "[TextBuffer]") {
+    FontTestContext context;
+    FontManager &font_manager = *context.font_manager;
+    const TrueTypeHandle ttf = context.ttf;
+
+    const FontHandle small_font = font_manager.CreateFontByPixelSize(ttf, 0, 16, FontType::Bitmap);
+    const FontHandle large_font = font_manager.CreateFontByPixelSize(ttf, 0, 64, FontType::Bitmap);
+    const FontInfo &small_info = font_manager.GetFontInfo(small_font);
+    const FontInfo &large_info = font_manager.GetFontInfo(large_font);
+
+    // the small glyph is placed above the clip rectangle, the large one on the same line moves it inside
+    const float clip_y = (small_info.ascender + large_info.ascender) / 2;
+    {
+        TextBuffer text_buffer(&font_manager);
+        text_buffer.SetClipRectangle(0, clip_y, 1000, 1000);
+        text_buffer.AppendText(small_font, "x");
+        text_buffer.AppendText(large_font, "X\n");
+        CHECK(text_buffer.GetVertexCount() == 8);
+    }
+
+    // a line that is still above the clip rectangle once it is aligned is dropped at its end
+    {
+        TextBuffer text_buffer(&font_manager);
+        text_buffer.SetClipRectangle(0, 2 * large_info.ascender, 1000, 1000);
+        text_buffer.AppendText(small_font, "x");
+        text_buffer.AppendText(large_font, "X\n");
+        CHECK(text_buffer.GetVertexCount() == 0);
+    }
+
+    font_manager.DestroyFont(large_font);
+    font_manager.DestroyFont(small_font);
+}
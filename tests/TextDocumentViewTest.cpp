@@ -0,0 +1,48 @@
+﻿#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include "FontTestContext.h"
+#include "../src/managers/TextBufferManager.h"
+#include "../src/managers/TextDocumentView.h"
+
+TEST_CASE("The document view is scissored to its viewport", "[TextDocumentView]") {
+    FontTestContext context;
+    FontManager &font_manager = *context.font_manager;
+    const FontHandle font = font_manager.CreateFontByPixelSize(context.ttf, 0, 16, FontType::Bitmap);
+
+    std::string document;
+    for (int line = 0; line < 100; ++line) {
+        document += std::string(400, (char) ('a' + line % 26)) + "\n";
+    }
+
+    const float viewport_x = 100, viewport_y = 50, viewport_width = 300, viewport_height = 200;
+    {
+        TextBufferManager text_buffer_manager(&font_manager);
+        TextDocumentView view(&text_buffer_manager, &font_manager, font, FontType::Bitmap);
+        view.SetDocument(document.data(), (uint32_t) document.size());
+        view.SetViewport(viewport_x, viewport_y, viewport_width, viewport_height);
+
+        // within a page and between lines the laid out text reaches past every edge of the viewport
+        const float scrolls[][2] = {{0, 0}, {150.5f, 37.25f}, {620, 500.75f}, {-20, -30}, {1e6f, 1e6f}};
+        for (const auto &scroll: scrolls) {
+            view.SetScroll(scroll[0], scroll[1]);
+            view.Submit(0);
+
+            const TextClipRectangle scissor = view.GetScissor();
+            CHECK(scissor.x >= viewport_x);
+            CHECK(scissor.y >= viewport_y);
+            CHECK(scissor.x + scissor.width <= viewport_x + viewport_width);
+            CHECK(scissor.y + scissor.height <= viewport_y + viewport_height);
+        }
+
+        // the document covers the whole viewport, the partially visible lines and glyphs are cut, not dropped
+        view.SetScroll(150.5f, 37.25f);
+        view.Submit(0);
+        const TextClipRectangle scissor = view.GetScissor();
+        CHECK(scissor.x == viewport_x);
+        CHECK(scissor.y == viewport_y);
+        CHECK(scissor.width == viewport_width);
+        CHECK(scissor.height == viewport_height);
+    }
+
+    font_manager.DestroyFont(font);
+}
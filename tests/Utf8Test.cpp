@@ -0,0 +1,69 @@
+﻿#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include "../src/font_processing/utf8.h"
+
+// decode one byte at a time, the reference the batch decoder must match
+static std::vector<uint32_t> DecodeReference(const std::string &string) {
+    std::vector<uint32_t> code_points;
+    uint32_t state = UTF8_ACCEPT, code_point = 0;
+    for (char c: string) {
+        if (c == 0) break;
+        if (Utf8Decode(&state, &code_point, (uint8_t) c) == UTF8_ACCEPT) code_points.push_back(code_point);
+    }
+    return code_points;
+}
+
+static std::vector<uint32_t> DecodeBatch(const std::string &string, bool null_terminated, uint32_t chunk_size) {
+    std::vector<uint32_t> code_points;
+    std::vector<uint32_t> chunk(chunk_size);
+    uint32_t state = UTF8_ACCEPT, code_point = 0;
+    const char *current = string.c_str();
+    const char *end = null_terminated ? nullptr : string.c_str() + string.size();
+
+    uint32_t count;
+    do {
+        count = Utf8DecodeBatch(&state, &code_point, &current, end, chunk.data(), chunk_size);
+        code_points.insert(code_points.end(), chunk.begin(), chunk.begin() + count);
+    } while (count == chunk_size);
+    return code_points;
+}
+
+TEST_CASE("Utf8DecodeBatch", "[Utf8]") {
+    SECTION("ASCII runs") {
+        const std::string text = "The quick brown fox jumps over the lazy dog, 0123456789 times!";
+        REQUIRE(DecodeBatch(text, true, 256) == DecodeReference(text));
+        REQUIRE(DecodeBatch(text, false, 256) == DecodeReference(text));
+        REQUIRE(DecodeBatch(text, false, 256).size() == text.size());
+    }
+
+    SECTION("Multibyte sequences between ASCII runs") {
+        const std::string text = "Ascii run longer than sixteen bytes \xC4\x8D\xC5\xA1\xC5\xBE then \xE2\x82\xAC and \xF0\x9F\x98\x80 emoji, ascii again until the end";
+        const auto expected = DecodeReference(text);
+        for (uint32_t chunk_size: {1u, 7u, 16u, 17u, 256u}) {
+            REQUIRE(DecodeBatch(text, true, chunk_size) == expected);
+            REQUIRE(DecodeBatch(text, false, chunk_size) == expected);
+        }
+    }
+
+    SECTION("Stops at the null character") {
+        const std::string text = std::string("0123456789abcdefghij") + '\0' + "klmnopqrstuvwxyz0123456789";
+        REQUIRE(DecodeBatch(text, false, 256).size() == 20);
+    }
+
+    SECTION("Random strings match the reference decoder") {
+        std::mt19937 random(42);
+        const char *pieces[] = {"a", "Hello world ", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "0123456789abcdef", "\n"};
+        for (int i = 0; i < 100; i++) {
+            std::string text;
+            const int piece_count = (int) (random() % 64);
+            for (int j = 0; j < piece_count; j++) {
+                text += pieces[random() % (sizeof(pieces) / sizeof(pieces[0]))];
+            }
+            const auto expected = DecodeReference(text);
+            REQUIRE(DecodeBatch(text, true, 256) == expected);
+            REQUIRE(DecodeBatch(text, false, 13) == expected);
+        }
+    }
+}